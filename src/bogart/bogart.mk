@@ -11,6 +11,7 @@ TARGET   := bogart
 SOURCES  := bogart.C \
             AS_BAT_AssemblyGraph.C \
             AS_BAT_BestOverlapGraph.C \
+            AS_BAT_Checkpoint.C \
             AS_BAT_ChunkGraph.C \
             AS_BAT_CreateUnitigs.C \
             AS_BAT_DropDeadEnds.C \
@@ -21,6 +22,7 @@ SOURCES  := bogart.C \
             AS_BAT_OptimizePositions.C \
             AS_BAT_Outputs.C \
             AS_BAT_OverlapCache.C \
+            AS_BAT_PathLength.C \
             AS_BAT_PlaceContains.C \
             AS_BAT_PlaceReadUsingOverlaps.C \
             AS_BAT_PopulateUnitig.C \
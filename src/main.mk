@@ -37,6 +37,8 @@ SOURCES      := AS_global.C \
                 \
                 utility/system.C \
                 utility/system-stackTrace.C \
+                utility/threadPlacement.C \
+                utility/allocProfile.C \
                 \
                 utility/sequence.C \
                 \
@@ -45,15 +47,20 @@ SOURCES      := AS_global.C \
                 utility/kmers-writer.C \
                 utility/kmers-writer-block.C \
                 utility/kmers-writer-stream.C \
+                utility/kmers-writer-queue.C \
                 utility/kmers-statistics.C \
                 utility/kmers-exact.C \
                 \
                 utility/bits.C \
                 \
+                utility/checkpoint.C \
                 utility/hexDump.C \
                 utility/md5.C \
+                utility/memoryArena.C \
+                utility/memoryBudget.C \
                 utility/mt19937ar.C \
                 utility/objectStore.C \
+                utility/perfCounters.C \
                 utility/speedCounter.C \
                 utility/sweatShop.C \
                 \
@@ -72,6 +79,7 @@ SOURCES      := AS_global.C \
                 stores/ovOverlap.C \
                 stores/ovStore.C \
                 stores/ovStoreWriter.C \
+                stores/ovStoreBucketWriter.C \
                 stores/ovStoreFilter.C \
                 stores/ovStoreFile.C \
                 stores/ovStoreHistogram.C \
@@ -88,6 +96,7 @@ SOURCES      := AS_global.C \
                 overlapInCore/overlapReadCache.C \
                 \
                 overlapErrorAdjustment/analyzeAlignment.C \
+                overlapErrorAdjustment/correctionOutput.C \
                 \
                 overlapInCore/liboverlap/Binomial_Bound.C \
                 overlapInCore/liboverlap/Display_Alignment.C \
@@ -139,7 +148,6 @@ SRC_INCDIRS  := . \
                 utgcns/libcns \
                 utgcns/libpbutgcns \
                 utgcns/libNDFalcon \
-                utgcns/libboost \
                 overlapInCore \
                 overlapInCore/liboverlap
 
@@ -218,6 +226,16 @@ SUBMAKEFILES := stores/dumpBlob.mk \
 
 ifeq ($(BUILDTESTS), 1)
 SUBMAKEFILES += utility/bitsTest.mk \
+                utility/checkpointTest.mk \
                 utility/filesTest.mk \
-                utility/stddevTest.mk
+                utility/memoryArenaTest.mk \
+                utility/memoryBudgetTest.mk \
+                utility/sequenceTest.mk \
+                utility/stddevTest.mk \
+                utility/edlibTest.mk \
+                utility/benchmarkTest.mk \
+                stores/loadTrimmedReadsTest.mk \
+                stores/ovStoreFileTest.mk \
+                meryl/merylLookupTest.mk \
+                bogart/pathLengthTest.mk
 endif
@@ -9,6 +9,7 @@ endif
 
 TARGET   := splitReads
 SOURCES  := splitReads.C \
+            splitReads-pipeline.C \
             splitReads-workUnit.C \
             splitReads-subReads.C \
             splitReads-trimBad.C \
@@ -11,7 +11,13 @@ TARGET   := trimReads
 SOURCES  := trimReads.C \
             trimReads-bestEdge.C \
             trimReads-largestCovered.C \
-            trimReads-quality.C
+            trimReads-quality.C \
+            splitReads-pipeline.C \
+            splitReads-workUnit.C \
+            splitReads-subReads.C \
+            splitReads-trimBad.C \
+            adjustNormal.C \
+            adjustFlipped.C
 
 SRC_INCDIRS  := .. ../utility ../stores
 
@@ -11,6 +11,7 @@ TARGET   := correctOverlaps
 SOURCES  := correctOverlaps.C \
             correctOverlaps-Correct_Frags.C \
             correctOverlaps-Read_Olaps.C \
+            correctOverlaps-Output.C \
             correctOverlaps-Redo_Olaps.C \
             correctOverlaps-Prefix_Edit_Distance.C
 
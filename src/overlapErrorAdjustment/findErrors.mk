@@ -14,7 +14,13 @@ SOURCES  := findErrors.C \
             findErrors-Prefix_Edit_Distance.C \
             findErrors-Process_Olap.C \
             findErrors-Read_Frags.C \
-            findErrors-Read_Olaps.C
+            findErrors-Read_Olaps.C \
+            findErrors-Correct_Overlaps.C \
+            correctOverlaps-Correct_Frags.C \
+            correctOverlaps-Read_Olaps.C \
+            correctOverlaps-Output.C \
+            correctOverlaps-Redo_Olaps.C \
+            correctOverlaps-Prefix_Edit_Distance.C
 
 SRC_INCDIRS  := .. ../utility ../stores ../overlapInCore/liboverlap
 
@@ -10,8 +10,11 @@ endif
 TARGET   := overlapInCore
 SOURCES  := overlapInCore.C \
             overlapInCore-Build_Hash_Index.C \
+            overlapInCore-Hash_Cache.C \
+            overlapInCore-Minimizers.C \
             overlapInCore-Find_Overlaps.C \
             overlapInCore-Output.C \
+            overlapInCore-Output_Writer.C \
             overlapInCore-Process_Overlaps.C \
             overlapInCore-Process_String_Overlaps.C
 
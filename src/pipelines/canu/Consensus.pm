@@ -68,6 +68,12 @@ sub utgcns ($$$) {
 
     my $path    = "unitigging/5-consensus";
 
+    #  Unless the store lives in an object store, each job writes its tigs
+    #  directly into version 2 of the tigStore, and the .cns file is just a
+    #  marker that the job finished.
+
+    my $segment = (defined(isOS())) ? 0 : 1;
+
     open(F, "> $path/consensus.sh") or caExit("can't open '$path/consensus.sh' for writing: $!", undef);
 
     print F "#!" . getGlobal("shell") . "\n";
@@ -107,7 +113,8 @@ sub utgcns ($$$) {
     print F "\$bin/utgcns \\\n";
     print F "  -S ../$asm.\${tag}Store/partitionedReads.seqStore \\\n";      #  Optional; utgcns will default to this
     print F "  -T ../$asm.\${tag}Store 1 \$jobid \\\n";
-    print F "  -O ./\${tag}cns/\$jobid.cns.WORKING \\\n";
+    print F "  -O ./\${tag}cns/\$jobid.cns.WORKING \\\n"   if ($segment == 0);
+    print F "  -segment \\\n"                                if ($segment == 1);
     print F "  -maxcoverage " . getGlobal('cnsMaxCoverage') . " \\\n";
     print F "  -e " . getGlobal("cnsErrorRate") . " \\\n";
     print F "  -quick \\\n"      if (getGlobal("cnsConsensus") eq "quick");
@@ -115,8 +122,11 @@ sub utgcns ($$$) {
     print F "  -edlib    \\\n"   if (getGlobal("canuIteration") >= 0);
     print F "  -utgcns \\\n"     if (getGlobal("cnsConsensus") eq "utgcns");
     print F "  -threads " . getGlobal("cnsThreads") . " \\\n";
+    print F "  -memory " . getGlobal("cnsMemory") . " \\\n"   if (getGlobal("cnsMemory") > 0);
+    print F "  -checkpoint " . getGlobal("checkpointInterval") . " \\\n"   if (getGlobal("checkpointInterval") > 0);
     print F "&& \\\n";
-    print F "mv ./\${tag}cns/\$jobid.cns.WORKING ./\${tag}cns/\$jobid.cns \\\n";
+    print F "mv ./\${tag}cns/\$jobid.cns.WORKING ./\${tag}cns/\$jobid.cns \\\n"   if ($segment == 0);
+    print F "touch ./\${tag}cns/\$jobid.cns \\\n"                                   if ($segment == 1);
     print F "\n";
     print F stashFileShellCode("unitigging/5-consensus", "\${tag}cns/\$jobid.cns", "");
     print F "\n";
@@ -150,6 +160,10 @@ sub cleanupPartitions ($$) {
     print STDERR "-- Partitioned seqStore is older than tigs, rebuild partitioning (seqStore $seqTime days old; ctgStore $tigTime days old).\n";
 
     remove_tree("unitigging/$asm.${tag}Store/partitionedReads.seqStore");
+
+    #  Segments from the old partitioning must not be loaded with the new.
+
+    unlink glob("unitigging/$asm.${tag}Store/seqDB.v002.s*");
 }
 
 
@@ -170,6 +184,7 @@ sub partitionReads ($$) {
     $cmd .= "  -T  ./$asm.${tag}Store 1 \\\n";
     $cmd .= "  -b " . getGlobal("cnsPartitionMin") . " \\\n"   if (defined(getGlobal("cnsPartitionMin")));
     $cmd .= "  -p " . getGlobal("cnsPartitions")   . " \\\n"   if (defined(getGlobal("cnsPartitions")));
+    $cmd .= "  -c " . getGlobal("cnsMaxCoverage")  . " \\\n"   if (getGlobal("cnsMaxCoverage") > 0);
     $cmd .= "> ./$asm.${tag}Store/partitionedReads.log 2>&1";
 
     if (runCommand("unitigging", $cmd)) {
@@ -238,6 +253,11 @@ sub consensusConfigure ($) {
 
     my $firstTime = (! -e "$path/consensus.sh");
 
+    #  Decide on memory now, so utgcns can be told how much it has to share
+    #  between the tigs it computes at the same time.
+
+    estimateMemoryNeededForConsensusJobs($asm);
+
     if ((getGlobal("cnsConsensus") eq "quick") ||
         (getGlobal("cnsConsensus") eq "pbdagcon") ||
         (getGlobal("cnsConsensus") eq "utgcns")) {
@@ -523,7 +543,10 @@ sub consensusLoad ($) {
         $cmd  = "$bin/tgStoreLoad \\\n";
         $cmd .= "  -S ../$asm.seqStore \\\n";
         $cmd .= "  -T  ./$asm.ctgStore 2 \\\n";
+        $cmd .= "  -segments \\\n"   if (!defined(isOS()));
         $cmd .= "  -L ./5-consensus/ctgcns.files \\\n";
+        $cmd .= "  -threads " . getGlobal("executiveThreads") . " \\\n";
+        $cmd .= "  -readindex \\\n";
         $cmd .= "> ./5-consensus/ctgcns.files.ctgStoreLoad.err 2>&1";
 
         if (runCommand("unitigging", $cmd)) {
@@ -548,7 +571,10 @@ sub consensusLoad ($) {
         $cmd  = "$bin/tgStoreLoad \\\n";
         $cmd .= "  -S ../$asm.seqStore \\\n";
         $cmd .= "  -T  ./$asm.utgStore 2 \\\n";
+        $cmd .= "  -segments \\\n"   if (!defined(isOS()));
         $cmd .= "  -L ./5-consensus/utgcns.files \\\n";
+        $cmd .= "  -threads " . getGlobal("executiveThreads") . " \\\n";
+        $cmd .= "  -readindex \\\n";
         $cmd .= "> ./5-consensus/utgcns.files.utgStoreLoad.err 2>&1";
 
         if (runCommand("unitigging", $cmd)) {
@@ -606,6 +632,7 @@ sub consensusAnalyze ($) {
     $cmd .= "  -S ../$asm.seqStore \\\n";
     $cmd .= "  -T  ./$asm.ctgStore 2 \\\n";
     $cmd .= "  -s " . getGlobal("genomeSize") . " \\\n";
+    $cmd .= "  -threads " . getGlobal("executiveThreads") . " \\\n";
     $cmd .= "  -o ./$asm.ctgStore.coverageStat \\\n";
     $cmd .= "> ./$asm.ctgStore.coverageStat.err 2>&1";
 
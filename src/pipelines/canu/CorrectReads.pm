@@ -430,6 +430,7 @@ sub generateCorrectedReadsConfigure ($) {
     print F "\n";
     print F getBinDirectoryShellCode();
     print F "\n";
+    print F getStageShellCode();
     print F setWorkDirectoryShellCode($path);
     print F "\n";
     print F getJobIDShellCode();
@@ -438,7 +439,8 @@ sub generateCorrectedReadsConfigure ($) {
     print F "endid=0\n";
     print F "\n";
 
-    my $nJobs = 0;
+    my $nJobs  = 0;
+    my $maxMem = 0;
 
     open(B, "< $path/correctReadsPartition.batches") or caExit("can't open '$path/correctReadsPartition.batches' for reading: $!", undef);
     $_ = <B>;    #  Skip header line 1
@@ -455,10 +457,13 @@ sub generateCorrectedReadsConfigure ($) {
         print  F "  endid=$endID\n";
         print  F "fi\n";
 
-        $nJobs = $jobID;
+        $nJobs  = $jobID;
+        $maxMem = ($maxMem < $mem) ? $mem : $maxMem;
     }
     close(B);
 
+    print STDERR "--   Configured $nJobs jobs, each sized for " . getGlobal("corThreads") . " threads; the largest is estimated to need $maxMem GB.\n";
+
     print F "\n";
     print F "if [ \$bgnid -eq 0 ]; then\n";
     print F "  echo Error: Invalid job \$jobid requested, must be between 1 and $nJobs.\n";
@@ -484,12 +489,14 @@ sub generateCorrectedReadsConfigure ($) {
     print F fetchFileShellCode($path, "$asm.readsToCorrect", "");
     print F "\n";
 
-    print F "seqStore=\"../../$asm.seqStore\"\n";
+    print F stageStoreShellCode("seqStore", "../../$asm.seqStore", "");
     print F "\n";
 
+    #  A private copy for this job, only if there isn't a shared one.
+
     my $stageDir = getGlobal("stageDirectory");
 
-    if (defined($stageDir)) {
+    if ((defined($stageDir)) && (!defined(getGlobal("stageCache")))) {
         print F "if [ ! -d $stageDir ] ; then\n";
         print F "  mkdir -p $stageDir\n";
         print F "fi\n";
@@ -520,6 +527,7 @@ sub generateCorrectedReadsConfigure ($) {
     print F "  -ol " . getGlobal("minOverlapLength") . " \\\n";
     print F "  -p ./results/\$jobid.WORKING \\\n";
     print F "  -cns \\\n";
+    print F "  -checkpoint " . getGlobal("checkpointInterval") . " \\\n"   if (getGlobal("checkpointInterval") > 0);
     print F "  > ./results/\$jobid.err 2>&1 \\\n";
     print F "&& \\\n";
     print F "mv ./results/\$jobid.WORKING.cns ./results/\$jobid.cns \\\n";
@@ -527,7 +535,7 @@ sub generateCorrectedReadsConfigure ($) {
 
     print F stashFileShellCode("$path", "results/\$jobid.cns", "");
 
-    if (defined($stageDir)) {
+    if ((defined($stageDir)) && (!defined(getGlobal("stageCache")))) {
         print F "rm -rf $stageDir/$asm.seqStore\n";   #  Prevent accidents of 'rm -rf /' if stageDir = "/".
         print F "rmdir  $stageDir\n";
         print F "\n";
@@ -789,8 +789,10 @@ sub setOverlapDefaults ($$$) {
 
     setOverlapDefault($tag, "OvlHashBlockLength",  undef,                     "Amount of sequence (bp) to load into the overlap hash table");
     setOverlapDefault($tag, "OvlRefBlockLength",   undef,                     "Amount of sequence (bp) to search against the hash table per batch");
+    setOverlapDefault($tag, "OvlPartitionSample",  undef,                     "Amount of sequence (bp) to sample to balance batches by estimated cost instead of length");
     setOverlapDefault($tag, "OvlHashBits",         undef,                     "Width of the kmer hash.  Width 22=1gb, 23=2gb, 24=4gb, 25=8gb.  Plus 10b per ${tag}OvlHashBlockLength");
     setOverlapDefault($tag, "OvlHashLoad",         0.80,                      "Maximum hash table load.  If set too high, table lookups are inefficent; if too low, search overhead dominates run time; default 0.75");
+    setOverlapDefault($tag, "OvlHashCache",        undef,                     "Directory, usually node-local, where hash tables are saved and shared between jobs with the same hash reads");
     setOverlapDefault($tag, "OvlMerSize",          ($tag eq "cor") ? 19 : 22, "K-mer size for seeds in overlaps");
     setOverlapDefault($tag, "OvlMerThreshold",     undef,                     "K-mer frequency threshold; mers more frequent than this count are ignored");
     setOverlapDefault($tag, "OvlMerDistinct",      undef,                     "K-mer frequency threshold; the least frequent fraction of distinct mers can seed overlaps");
@@ -863,7 +865,12 @@ sub setDefaults () {
     setDefault("gnuplotImageFormat",  undef,      "Image format that gnuplot will generate.  Default: based on gnuplot, 'png', 'svg' or 'gif'");
 
     setDefault("stageDirectory",      undef,      "If set, copy heavily used data to this node-local location");
+    setDefault("stageCache",          undef,      "If set, stage sequence stores to this node-local directory, shared by all jobs on the node");
     setDefault("preExec",             undef,      "A command line to run at the start of Canu execution scripts");
+    setDefault("threadPlacement",     "none",     "Bind threads to NUMA nodes: 'none', 'compact' (fill one node first) or 'spread' (round-robin over nodes)");
+    setDefault("memoryPlacement",     undef,      "Where big tables are allocated on NUMA machines: 'none', 'firsttouch' or 'interleave'; default 'firsttouch' if threads are placed");
+    setDefault("allocationProfile",   0,          "Profile memory allocations in every job, sampling a call stack once per this many KB allocated; 0 to disable");
+    setDefault("checkpointInterval",  600,        "Seconds between checkpoints of read correction and consensus jobs, so a killed job can resume; 0 to disable");
 
     #####  Cleanup and Termination options
 
@@ -978,6 +985,7 @@ sub setDefaults () {
     setDefault("objectStoreClientDA",  undef,  "Path to the command line client used to download files from object storage");
     setDefault("objectStoreNameSpace", undef,  "Object store parameters; specific to the type of objectStore used");
     setDefault("objectStoreProject",   undef,  "Object store project; specific to the type of objectStore used");
+    setDefault("objectStoreCache",     undef,  "Node-local directory where jobs share files fetched from the object store");
 
     #####  Overlapper
 
@@ -989,16 +997,22 @@ sub setDefaults () {
 
     #  ovbMemory and ovsMemory are set above.
 
+    setDefault("ovsMethod", undef, "Build overlap stores with 'sequential' (one ovStoreBuild job) or 'parallel' (bucketizer and sorter jobs); default: whichever is estimated to be faster");
+    setDefault("ovsRanges", 0,     "Overlappers write outputs split into this many read ranges, so the parallel store build needs no bucketizer jobs; default 0, write ovb files");
+
     #####  Executive
 
     setDefault("executiveMemory",   4,   "Amount of memory, in GB, to reserve for the Canu exective process");
     setDefault("executiveThreads",  1,   "Number of threads to reserve for the Canu exective process");
 
+    setDefault("gridSizeFromObserved", 0, "Request only the memory (plus 25% and 1 GB) that earlier jobs in the same step were seen to use; default false");
+
     #####  Mers
 
     setDefault("merylMemory",      undef,  "Amount of memory, in gigabytes, to use for mer counting");
     setDefault("merylThreads",     undef,  "Number of threads to use for mer counting");
     setDefault("merylConcurrency", undef,  "Unused, there is only one process");
+    setDefault("merylShards",      0,      "Count kmers with this many jobs, each writing a piece of one database, instead of merging per-segment databases");
 
     #####  Haplotyping
 
@@ -1579,6 +1593,27 @@ sub checkParameters () {
         addCommandLineError("ERROR:  objectStoreProject must be specified if objectStore=DNANEXUS is specified\n");
     }
 
+    if ((defined(getGlobal("objectStore"))) && (getGlobal("ovsRanges") > 0)) {
+        addCommandLineError("ERROR:  ovsRanges can't be used with an objectStore\n");
+    }
+
+    if ((defined(getGlobal("objectStore"))) && (defined(getGlobal("stageCache")))) {
+        addCommandLineError("ERROR:  stageCache can't be used with an objectStore; use objectStoreCache\n");
+    }
+
+    if (getGlobal("threadPlacement") !~ m/^(none|compact|spread)$/) {
+        addCommandLineError("ERROR:  Invalid 'threadPlacement' specified (" . getGlobal("threadPlacement") . "); must be 'none', 'compact' or 'spread'\n");
+    }
+
+    if ((defined(getGlobal("memoryPlacement"))) &&
+        (getGlobal("memoryPlacement") !~ m/^(none|firsttouch|interleave)$/)) {
+        addCommandLineError("ERROR:  Invalid 'memoryPlacement' specified (" . getGlobal("memoryPlacement") . "); must be 'none', 'firsttouch' or 'interleave'\n");
+    }
+
+    if (getGlobal("allocationProfile") !~ m/^\d+$/) {
+        addCommandLineError("ERROR:  Invalid 'allocationProfile' specified (" . getGlobal("allocationProfile") . "); must be a sampling interval in KB, or 0 to disable\n");
+    }
+
 
     if (defined(getGlobal("stopAfter"))) {
         my $ok = 0;
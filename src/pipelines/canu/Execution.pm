@@ -62,6 +62,8 @@ require Exporter;
              getInstallDirectory
              getJobIDShellCode
              getLimitShellCode
+             getStageShellCode
+             stageStoreShellCode
              getBinDirectory
              getBinDirectoryShellCode
              setWorkDirectory
@@ -80,7 +82,7 @@ use warnings "all";
 no  warnings "uninitialized";
 
 use Config;            #  for @signame
-use Cwd qw(getcwd);
+use Cwd qw(getcwd abs_path);
 use Carp qw(longmess);
 
 use POSIX ":sys_wait_h";  #  For waitpid(..., &WNOHANG)
@@ -147,22 +149,45 @@ sub logFinished ($$) {
 #  Functions for running multiple processes at the same time.  This is private to the module.
 #
 
+#  Jobs are started, in order, while there are fewer than $numberOfProcesses
+#  running, and while the threads and memory they declared fit in what is
+#  left of $numberOfThreads and $numberOfMemory (GB).  A limit of zero is no
+#  limit.  A job is always started if nothing is running, even if it is
+#  bigger than the limits.
+#
+
 my $numberOfProcesses       = 0;     #  Number of jobs concurrently running
 my $numberOfProcessesToWait = 0;     #  Number of jobs we can leave running at exit
-my @processQueue            = ();
+my $numberOfThreads         = 0;     #  Threads available to jobs
+my $numberOfMemory          = 0;     #  Memory available to jobs
+my @processQueue            = ();    #  [command, threads, memory] of jobs waiting to run
 my @processesRunning        = ();
+my %processThreads;                  #  Threads and memory declared by each running job, by pid
+my %processMemory;
+my $threadsRunning          = 0;
+my $memoryRunning           = 0;
 my $printProcessCommand     = 1;     #  Show commands as they run
 
 sub schedulerSetNumberOfProcesses {
     $numberOfProcesses = shift @_;
 }
 
-sub schedulerSubmit ($) {
+sub schedulerSetResources ($$) {
+    $numberOfThreads = shift @_;
+    $numberOfMemory  = shift @_;
+}
+
+sub schedulerSubmit ($;$$) {
     my $cmd = shift @_;
+    my $thr = shift @_;
+    my $mem = shift @_;
 
     chomp $cmd;
 
-    push @processQueue, $cmd;
+    $thr = 1  if (!defined($thr));
+    $mem = 0  if (!defined($mem));
+
+    push @processQueue, [ $cmd, $thr, $mem ];
 }
 
 sub schedulerForkProcess ($) {
@@ -199,24 +224,61 @@ sub schedulerReapProcess ($) {
     }
 }
 
-sub schedulerRun () {
+#  Forget about a process that has finished, returning its resources.
+sub schedulerRemoveProcess ($) {
+    my $pid = shift @_;
     my @running;
 
+    foreach my $i (@processesRunning) {
+        push @running, $i  if ($i != $pid);
+    }
+
+    @processesRunning = @running;
+
+    $threadsRunning -= $processThreads{$pid}  if (exists($processThreads{$pid}));
+    $memoryRunning  -= $processMemory{$pid}   if (exists($processMemory{$pid}));
+
+    delete $processThreads{$pid};
+    delete $processMemory{$pid};
+}
+
+#  True if the next job in the queue can start now.
+sub schedulerJobFits () {
+    my $thr = $processQueue[0]->[1];
+    my $mem = $processQueue[0]->[2];
+
+    return(1)  if (scalar(@processesRunning) == 0);
+    return(0)  if (scalar(@processesRunning) >= $numberOfProcesses);
+    return(0)  if (($numberOfThreads > 0) && ($threadsRunning + $thr > $numberOfThreads));
+    return(0)  if (($numberOfMemory  > 0) && ($memoryRunning  + $mem > $numberOfMemory + 0.001));
+    return(1);
+}
+
+sub schedulerRun () {
+
     #  Reap any processes that have finished
 
     foreach my $i (@processesRunning) {
-        push @running, $i  if (schedulerReapProcess($i) == 0);
+        schedulerRemoveProcess($i)  if (schedulerReapProcess($i) == 1);
     }
 
-    @processesRunning = @running;
+    #  Run processes while they fit
 
-    #  Run processes in any available slots
+    while ((scalar(@processQueue) > 0) &&
+           (schedulerJobFits() == 1)) {
+        my ($process, $thr, $mem) = @{ shift @processQueue };
 
-    while ((scalar(@processesRunning) < $numberOfProcesses) &&
-           (scalar(@processQueue) > 0)) {
-        my $process = shift @processQueue;
         print STDERR "    $process\n";
-        push @processesRunning, schedulerForkProcess($process);
+
+        my $pid = schedulerForkProcess($process);
+
+        push @processesRunning, $pid;
+
+        $processThreads{$pid} = $thr;
+        $processMemory{$pid}  = $mem;
+
+        $threadsRunning += $thr;
+        $memoryRunning  += $mem;
     }
 }
 
@@ -224,7 +286,6 @@ sub schedulerFinish ($$) {
     my $dir = shift @_;
     my $nam = shift @_;
     my $child;
-    my @newProcesses;
     my $remain;
 
     $remain = scalar(@processQueue);
@@ -251,19 +312,18 @@ sub schedulerFinish ($$) {
         if ($remain > 0) {
             $child = waitpid -1, 0;
 
-            undef @newProcesses;
-            foreach my $i (@processesRunning) {
-                push @newProcesses, $i if ($child != $i);
-            }
-            undef @processesRunning;
-            @processesRunning = @newProcesses;
+            schedulerRemoveProcess($child);
         }
     }
 
     #  Wait for them to finish, if requested
     #
     while (scalar(@processesRunning) > $numberOfProcessesToWait) {
-        waitpid(shift @processesRunning, 0);
+        my $pid = $processesRunning[0];
+
+        waitpid($pid, 0);
+
+        schedulerRemoveProcess($pid);
     }
 
     logFinished($dir, $startsecs);
@@ -419,6 +479,175 @@ sub getLimitShellCode () {
 }
 
 
+#  Emits shell functions to stage stores to node-local disk (stageCache), so
+#  jobs don't all read them from the shared file system.  A store is copied
+#  once per node and shared by every job on the node.
+#
+#  Each copy is named after the store and a signature of its files, so a store
+#  that changes gets a new copy.  Jobs using a copy register in
+#  'copy.users/host.pid'; registrations of jobs that are no longer running are
+#  removed.  Copies are kept after the job finishes, for the next job, and
+#  copies with no users are evicted, least recently used first, when space is
+#  needed for a new one.
+#
+#  The first job to want a copy makes it, holding 'copy.lock'; the others wait.
+#  If the copy stops making progress for ten minutes, the lock is broken and
+#  the next job tries again.  If the store can't be staged, it is used where it
+#  is.
+#
+#  Only files at the top level of the store are copied.
+#
+sub getStageShellCode () {
+    my $cache = getGlobal("stageCache");
+    my $string;
+
+    return("")   if (!defined($cache));
+
+    $string .= "#  Stage stores to node-local disk, shared by all jobs on this node.\n";
+    $string .= "#\n";
+    $string .= "stageCache=\"$cache\"\n";
+    $string .= "stageUsers=\"\"\n";
+    $string .= "\n";
+    $string .= "stageRelease() {\n";
+    $string .= "  rm -f \$stageUsers\n";
+    $string .= "}\n";
+    $string .= "\n";
+    $string .= "stageLock() {\n";
+    $string .= "  while ! mkdir \$stageCache/.lock 2> /dev/null ; do\n";
+    $string .= "    if [ x`find \$stageCache/.lock -prune -mmin +5 2> /dev/null` != x ] ; then\n";
+    $string .= "      rmdir \$stageCache/.lock 2> /dev/null\n";
+    $string .= "    fi\n";
+    $string .= "    sleep 1\n";
+    $string .= "  done\n";
+    $string .= "}\n";
+    $string .= "\n";
+    $string .= "stageUnlock() {\n";
+    $string .= "  rmdir \$stageCache/.lock\n";
+    $string .= "}\n";
+    $string .= "\n";
+    $string .= "stageAvail() {\n";
+    $string .= "  df -Pk \$stageCache | awk 'NR == 2 { print \$4 }'\n";
+    $string .= "}\n";
+    $string .= "\n";
+    $string .= "#  Remove registrations of jobs on this host that are no longer running.\n";
+    $string .= "stageReap() {\n";
+    $string .= "  for r in \$1/* ; do\n";
+    $string .= "    if [ -e \$r ] ; then\n";
+    $string .= "      h=`basename \$r | sed 's/\\.[0-9]*\$//'`\n";
+    $string .= "      p=`basename \$r | sed 's/^.*\\.//'`\n";
+    $string .= "      if [ \$h = `hostname` ] && ! kill -0 \$p 2> /dev/null ; then\n";
+    $string .= "        rm -f \$r\n";
+    $string .= "      fi\n";
+    $string .= "    fi\n";
+    $string .= "  done\n";
+    $string .= "}\n";
+    $string .= "\n";
+    $string .= "#  Evict unused copies, least recently used first, until \$1 KB is free.\n";
+    $string .= "#  Must hold stageLock.\n";
+    $string .= "stageEvict() {\n";
+    $string .= "  for u in `ls -dtr \$stageCache/*.users 2> /dev/null` ; do\n";
+    $string .= "    if [ `stageAvail` -ge \$1 ] ; then\n";
+    $string .= "      return\n";
+    $string .= "    fi\n";
+    $string .= "    stageReap \$u\n";
+    $string .= "    if [ `ls \$u | wc -l` -eq 0 ] ; then\n";
+    $string .= "      c=`dirname \$u`/`basename \$u .users`\n";
+    $string .= "      echo \"Evicting '\$c' from the stage cache.\"\n";
+    $string .= "      rm -rf \$c \$c.partial\n";
+    $string .= "      rmdir \$c.lock \$u 2> /dev/null\n";
+    $string .= "    fi\n";
+    $string .= "  done\n";
+    $string .= "}\n";
+    $string .= "\n";
+    $string .= "#  Stage store \$1, setting 'staged' to the path to use.\n";
+    $string .= "stageStore() {\n";
+    $string .= "  staged=\$1\n";
+    $string .= "\n";
+    $string .= "  if ! mkdir -p \$stageCache 2> /dev/null ; then\n";
+    $string .= "    echo \"Can't create stage cache '\$stageCache'; using '\$1' directly.\"\n";
+    $string .= "    return\n";
+    $string .= "  fi\n";
+    $string .= "\n";
+    $string .= "  copy=\$stageCache/`basename \$1`.`( cd \$1 && pwd && ls -lL ) | cksum | awk '{ print \$1 }'`\n";
+    $string .= "  user=\$copy.users/`hostname`.\$\$\n";
+    $string .= "  need=`ls -lL \$1 | awk '/^-/ { s += \$5 } END { print int(s / 1024) + 1 }'`\n";
+    $string .= "\n";
+    $string .= "  stageLock\n";
+    $string .= "  mkdir -p \$copy.users\n";
+    $string .= "  touch \$user\n";
+    $string .= "  stageUsers=\"\$stageUsers \$user\"\n";
+    $string .= "  if [ ! -e \$copy/.complete ] ; then\n";
+    $string .= "    stageEvict \$need\n";
+    $string .= "    if [ `stageAvail` -lt \$need ] ; then\n";
+    $string .= "      rm -f \$user\n";
+    $string .= "      stageUnlock\n";
+    $string .= "      echo \"Not enough space in stage cache '\$stageCache'; using '\$1' directly.\"\n";
+    $string .= "      return\n";
+    $string .= "    fi\n";
+    $string .= "  fi\n";
+    $string .= "  stageUnlock\n";
+    $string .= "\n";
+    $string .= "  trap stageRelease EXIT\n";
+    $string .= "  trap 'exit 1' HUP INT TERM\n";
+    $string .= "\n";
+    $string .= "  while [ ! -e \$copy/.complete ] ; do\n";
+    $string .= "    if mkdir \$copy.lock 2> /dev/null ; then\n";
+    $string .= "      echo \"Staging '\$1' to '\$copy', starting at `date`.\"\n";
+    $string .= "      rm -rf \$copy \$copy.partial\n";
+    $string .= "      mkdir \$copy.partial\n";
+    $string .= "      for f in \$1/* ; do\n";
+    $string .= "        if [ -f \$f ] ; then\n";
+    $string .= "          cp -pL \$f \$copy.partial/ || break\n";
+    $string .= "        fi\n";
+    $string .= "      done\n";
+    $string .= "      if [ `ls -lL \$1 | grep -c '^-'` -eq `ls -l \$copy.partial | grep -c '^-'` ] ; then\n";
+    $string .= "        touch \$copy.partial/.complete\n";
+    $string .= "        mv \$copy.partial \$copy\n";
+    $string .= "        echo \"Staged at `date`.\"\n";
+    $string .= "      else\n";
+    $string .= "        echo \"Failed to stage '\$1'; using it directly.\"\n";
+    $string .= "        rm -rf \$copy.partial\n";
+    $string .= "        rmdir \$copy.lock\n";
+    $string .= "        return\n";
+    $string .= "      fi\n";
+    $string .= "      rmdir \$copy.lock\n";
+    $string .= "    elif [ x`find \$copy.lock \$copy.partial -cmin -10 2> /dev/null | head -n 1` = x ] ; then\n";
+    $string .= "      echo \"Breaking stale stage lock '\$copy.lock'.\"\n";
+    $string .= "      rm -rf \$copy.partial\n";
+    $string .= "      rmdir \$copy.lock\n";
+    $string .= "    else\n";
+    $string .= "      sleep 5\n";
+    $string .= "    fi\n";
+    $string .= "  done\n";
+    $string .= "\n";
+    $string .= "  staged=\$copy\n";
+    $string .= "}\n";
+    $string .= "\n";
+
+    return($string);
+}
+
+
+#  Emits shell code to set shell variable '$var' to the path of '$store' to
+#  use: the staged copy if stageCache is set, otherwise the store itself.
+#
+sub stageStoreShellCode ($$$) {
+    my $var    = shift @_;
+    my $store  = shift @_;
+    my $indent = shift @_;
+    my $code   = "";
+
+    if (defined(getGlobal("stageCache"))) {
+        $code .= "${indent}stageStore $store\n";
+        $code .= "${indent}$var=\$staged\n";
+    } else {
+        $code .= "${indent}$var=$store\n";
+    }
+
+    return($code);
+}
+
+
 #  Used inside canu to find where binaries are located.
 #
 sub getBinDirectory () {
@@ -494,9 +723,27 @@ sub getBinDirectoryShellCode () {
     $string .= "export CANU_OBJECT_STORE_CLIENT_DA=" . getGlobal("objectStoreClientDA")  . "\n";
     $string .= "export CANU_OBJECT_STORE_NAMESPACE=" . getGlobal("objectStoreNameSpace") . "\n";
     $string .= "export CANU_OBJECT_STORE_PROJECT="   . getGlobal("objectStoreProject")   . "\n";
+    $string .= "export CANU_OBJECT_STORE_CACHE="     . getGlobal("objectStoreCache")     . "\n"   if (defined(getGlobal("objectStoreCache")));
     $string .= "\n";
     $string .= "\n";
 
+    if ((getGlobal("threadPlacement") ne "none") || (defined(getGlobal("memoryPlacement")))) {
+        $string .= "#  Thread and memory placement on NUMA machines.\n";
+        $string .= "\n";
+        $string .= "export CANU_THREAD_PLACEMENT=" . getGlobal("threadPlacement") . "\n";
+        $string .= "export CANU_MEMORY_PLACEMENT=" . getGlobal("memoryPlacement") . "\n"   if (defined(getGlobal("memoryPlacement")));
+        $string .= "\n";
+        $string .= "\n";
+    }
+
+    if (getGlobal("allocationProfile") > 0) {
+        $string .= "#  Profile allocations; the report is part of the performance summary.\n";
+        $string .= "\n";
+        $string .= "export CANU_ALLOC_PROFILE=" . getGlobal("allocationProfile") . "\n";
+        $string .= "\n";
+        $string .= "\n";
+    }
+
     return($string);
 }
 
@@ -889,7 +1136,8 @@ sub buildStageOption ($$) {
     my $d = shift @_;
     my $r;
 
-    if ($t eq "cor") {
+    if (($t eq "cor") ||
+        ((defined(getGlobal("stageCache"))) && (defined($d)))) {
         $r =  getGlobal("gridEngineStageOption");
         $r =~ s/DISK_SPACE/${d}/g;
     }
@@ -1134,6 +1382,50 @@ sub countJobsInRange (@) {
 
 
 
+#  Find the largest memory, wall and CPU time used by any program that ran
+#  in directory $path, from the performance summaries the binaries write
+#  into canu-perf/ (see src/utility/perfCounters.C).  Programs killed for
+#  running out of memory don't leave a summary, so this is only ever a lower
+#  bound on what a job needs.
+#
+sub observedJobResources ($) {
+    my $path = abs_path(shift @_);
+    my $dir  = "$ENV{'CANU_DIRECTORY'}/canu-perf";
+    my ($n, $mem, $wall, $cpu) = (0, 0, 0, 0);
+
+    return($n, $mem, $wall, $cpu)   if ((!defined($path)) || (! -d $dir));
+
+    open(L, "ls $dir/*.json 2> /dev/null |");
+    while (<L>) {
+        chomp;
+
+        next   if (m/\.trace\.json$/);
+
+        my ($d, $m, $w, $c);
+
+        open(J, "< $_") or next;
+        while (<J>) {
+            $d = $1   if (m/^\s*"directory":\s*"(.*)",$/);
+            $w = $1   if (m/^\s*"wallSeconds":\s*([0-9.]+),$/);
+            $c = $1   if (m/^\s*"cpuSeconds":\s*([0-9.]+),$/);
+            $m = $1   if (m/^\s*"maxMemoryBytes":\s*(\d+),$/);
+        }
+        close(J);
+
+        next   if ((!defined($d)) || ($d ne $path) || (!defined($m)));
+
+        $n++;
+        $mem  = max($mem,  $m / 1024 / 1024 / 1024);
+        $wall = max($wall, $w);
+        $cpu  = max($cpu,  $c);
+    }
+    close(L);
+
+    return($n, $mem, $wall, $cpu);
+}
+
+
+
 #  Expects
 #    job type ("ovl", etc)
 #    output directory
@@ -1164,6 +1456,34 @@ sub submitOrRunParallelJob ($$$$@) {
 
     makeExecutable("$path/$script.sh");
 
+    #  If jobs have already run here (an earlier attempt, or an earlier
+    #  batch of jobs), report what they used, and, if allowed, ask for no
+    #  more memory than that, plus 25% and a gigabyte.  Never ask for more
+    #  than configured: jobs that failed for lack of memory left no record.
+
+    my ($nObs, $obsMem, $obsWall, $obsCPU) = observedJobResources($path);
+
+    if ($nObs > 0) {
+        my $newMem = int($obsMem * 1.25 + 1);
+
+        print STDERR "--\n";
+        printf STDERR "-- Jobs in '$path' used up to %.3f GB memory, %.1f wall-hours and %.1f cpu-hours (%d programs).\n",
+                      $obsMem, $obsWall / 3600, $obsCPU / 3600, $nObs;
+
+        if ((getGlobal("gridSizeFromObserved") == 1) && ($newMem < $mem)) {
+            print STDERR "-- Reducing ${jobType}Memory from $mem GB to $newMem GB for these jobs.\n";
+            $mem = $newMem;
+        }
+    }
+
+    #  Remember what these jobs reserved, so the report can compare it to
+    #  what they used.
+
+    if (open(F, "> $path/$script.resources")) {
+        print F "$jobType $mem $thr\n";
+        close(F);
+    }
+
     #  If the job can fit in the task running the executive, run it right here.
 
     if (($nJobs * $mem + 0.5 <= getGlobal("executiveMemory")) &&
@@ -1388,7 +1708,7 @@ sub submitOrRunParallelJob ($$$$@) {
         }
 
         for (my $i=$st; $i<=$ed; $i++) {
-            schedulerSubmit("./$script.sh $i > ./" . buildOutputName($path, $script, $i) . " 2>&1");
+            schedulerSubmit("./$script.sh $i > ./" . buildOutputName($path, $script, $i) . " 2>&1", $thr, $mem);
         }
     }
 
@@ -1399,12 +1719,22 @@ sub submitOrRunParallelJob ($$$$@) {
 
     # compute limit based on physical memory
     my $nMParallel = getGlobal("${jobType}Concurrency");
-    $nMParallel    = int(getGlobal("maxMemory") / getGlobal("${jobType}Memory")) if ((!defined($nMParallel)) || ($nMParallel == 0));
-    $nMParallel    = 1                                                           if ((!defined($nMParallel)) || ($nMParallel == 0));
+    $nMParallel    = int(getGlobal("maxMemory") / $mem)  if ((!defined($nMParallel)) || ($nMParallel == 0));
+    $nMParallel    = 1                                   if ((!defined($nMParallel)) || ($nMParallel == 0));
 
     # run min of our limits
     my $nParallel  = $nCParallel < $nMParallel ? $nCParallel : $nMParallel;
 
+    # and never more threads or memory than we have, unless a concurrency
+    # was explicitly set, in which case the user knows best.
+    my $conc = getGlobal("${jobType}Concurrency");
+
+    if ((!defined($conc)) || ($conc == 0)) {
+        schedulerSetResources(getGlobal("maxThreads"), getGlobal("maxMemory"));
+    } else {
+        schedulerSetResources(0, 0);
+    }
+
     schedulerSetNumberOfProcesses($nParallel);
     schedulerFinish($path, $jobType);
 }
@@ -103,6 +103,7 @@ sub configureCloud ($) {
     $ENV{"CANU_OBJECT_STORE_CLIENT_DA"} = getGlobal("objectStoreClientDA");
     $ENV{"CANU_OBJECT_STORE_NAMESPACE"} = getGlobal("objectStoreNameSpace");
     $ENV{"CANU_OBJECT_STORE_PROJECT"}   = getGlobal("objectStoreProject");
+    $ENV{"CANU_OBJECT_STORE_CACHE"}     = getGlobal("objectStoreCache")   if (defined(getGlobal("objectStoreCache")));
 }
 
 
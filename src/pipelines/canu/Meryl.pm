@@ -49,7 +49,6 @@ no  warnings "uninitialized";
 use File::Path 2.08 qw(make_path remove_tree);
 use File::Basename;
 use File::Copy;
-use POSIX qw(floor ceil);
 
 use canu::Defaults;
 use canu::Execution;
@@ -352,27 +351,16 @@ sub merylConfigure ($$) {
     }
 
     #
-    #  Based on the number of reads in the store, decide on a preliminary set
-    #  of batch sizes to use.
+    #  Ask meryl for a plan: from the lengths of the reads in the store, it
+    #  decides how many segments to split the reads into, and how much memory
+    #  counting each one needs.
     #
 
     my $nr  = getNumberOfReadsInStore($asm, $tag);
     my $nb  = getNumberOfBasesInStore($asm, $tag);
 
-    my $maxSplit = int(floor($nb / 100000000));
-
-    $maxSplit = 1    if ($maxSplit == 0);
-    $maxSplit = $nr  if ($nr < $maxSplit);
-
-    #
-    #  Let meryl run to decide how much memory it wants to use.
-    #
-    #  This is a pretty stupid way to do it; this really should be built into meryl itself.
-    #
-
     my $mem = getGlobal("merylMemory");
     my $thr = getGlobal("merylThreads");
-    my $cov = getExpectedCoverage($tag, $asm);
 
     open(F, "> $path/meryl-configure.sh");
     print F "#!" . getGlobal("shell") . "\n";
@@ -381,15 +369,10 @@ sub merylConfigure ($$) {
     print F "\n";
     print F setWorkDirectoryShellCode($path);
     print F fetchSeqStoreShellCode($asm, $path, "");
-
-    foreach my $ss (qw(01 02 04 06 08 12 16 20 24 32 40 48 56 64 96)) {
-        next  if ($ss > $maxSplit);
-
-        print F "\n";
-        print F "$bin/meryl -C k=$merSize threads=$thr memory=$mem \\\n";
-        print F "  count segment=1/$ss ../../$asm.seqStore \\\n";
-        print F "> $name.config.$ss.out 2>&1";
-    }
+    print F "\n";
+    print F "$bin/meryl -plan k=$merSize threads=$thr memory=$mem \\\n";
+    print F "  count ../../$asm.seqStore \\\n";
+    print F "> $name.plan.out 2>&1\n";
     print F "\n";
     print F "exit 0\n";
     close(F);
@@ -397,16 +380,7 @@ sub merylConfigure ($$) {
     makeExecutable("$path/meryl-configure.sh");
     stashFile("$path/meryl-configure.sh");
 
-    my $runConfigure = 1;
-
-    foreach my $ss (qw(01 02 04 06 08 12 16 20 24 32 40 48 56 64 96)) {
-        if (-e "$path/$name.config.$ss.out") {
-            $runConfigure = 0;
-            next;
-        }
-    }
-
-    if ($runConfigure) {
+    if (! -e "$path/$name.plan.out") {
         if (runCommand($path, "./meryl-configure.sh > ./meryl-configure.err 2>&1")) {
             caFailure("meryl failed to configure", "$path/meryl-configure.err");
         }
@@ -414,52 +388,62 @@ sub merylConfigure ($$) {
     }
 
     #
-    #  Make sense of all the configuration attempts.  Pick the smallest number of segments that
-    #  results in the smallest number of batches.
+    #  Use the plan meryl picked, unless sharding, where the number of jobs
+    #  is fixed and we need the memory for that many segments.
     #
 
+    my $maxSplit;
     my $merylMemory;
     my $merylSegments;
-    my $merylBatches  = 1048576;
+    my $merylBatches;
+    my $merylShards   = getGlobal("merylShards");
+    my $shardMemory;
+
+    $merylShards = 0   if (defined(getGlobal("objectStore")));
+    $merylShards = 0   if ($merylShards < 2);
+    $merylShards = 64  if ($merylShards > 64);
 
     printf(STDERR "--  segments   memory batches\n");
     printf(STDERR "--  -------- -------- -------\n");
 
-    foreach my $ss (qw(01 02 04 06 08 12 16 20 24 32 40 48 56 64 96)) {
-        next  if ($ss > $maxSplit);
-
-        my $mem = undef;
-        my $bat = undef;
+    #  These messages come from meryl/merylOp-count.C planCounting().
 
-        if (! -e "$path/$name.config.$ss.out") {
-            next;
+    open(F, "< $path/$name.plan.out") or caExit("can't open '$path/$name.plan.out' for reading: $!", undef);
+    while (<F>) {
+        if (m/^Planning\s.*\sin\s+up\s+to\s+(\d+)\s+segment/) {
+            $maxSplit = $1;
         }
 
-        #  This message comes from meryl/merylOp-count.C reportNumberOfOutputs().
+        if (m/^Plan\s+for\s+(\d+)\s+segments*:.*\s(\d*.\d*)\s+GB\s+memory\s+per\s+batch,\s+and\s+up\s+to\s+(\d+)\s+batch/) {
+            my ($ss, $mem, $bat) = ($1, $2, $3);
 
-        open(F, "< $path/$name.config.$ss.out") or caExit("can't open '$path/$name.config.$ss.out' for reading: $!", undef);
-        while (<F>) {
-            if (m/Configured\s+\w+\s+mode\s+for\s+(\d*.\d*)\s+GB\s+memory\s+per\s+batch,\s+and\s+up\s+to\s+(\d+)\s+batch/) {
-                $mem = $1;
-                $bat = $2;
-            }
-        }
-        close(F);
+            printf(STDERR "--       %3s %5.2f GB     %3d\n", $ss, $mem, $bat);
 
-        caExit("failed to parse meryl configure output '$path/$name.config.$ss.out'", "$path/$name.config.$ss.out")   if (!defined($mem) || !defined($bat));
+            #  A shard holds about as many kmers as a segment does, so use the
+            #  memory of the largest segmentation not more than the shards.
 
-        if ($bat < $merylBatches) {
-            $merylMemory   = int($mem) + 2;
-            $merylSegments =     $ss;
-            $merylBatches  =     $bat;
+            $shardMemory = int($mem) + 2   if ($ss <= $merylShards);
         }
 
-        printf(STDERR "--       %3s %5.2f GB     %3d\n", $ss, $mem, $bat);
+        if (m/^Planned\s+(\d+)\s+segments*,.*\s(\d*.\d*)\s+GB\s+memory\s+per\s+batch,\s+and\s+up\s+to\s+(\d+)\s+batch/) {
+            $merylSegments = $1;
+            $merylMemory   = int($2) + 2;
+            $merylBatches  = $3;
+        }
+    }
+    close(F);
+
+    caExit("failed to parse meryl plan '$path/$name.plan.out'", "$path/$name.plan.out")   if (!defined($merylSegments));
+
+    if ($merylShards > 0) {
+        $merylMemory   = $shardMemory   if (defined($shardMemory));
+        $merylSegments = $merylShards;
     }
 
     print STDERR "--\n";
     print STDERR "--  For $nr reads with $nb bases, limit to $maxSplit batch", ($maxSplit == 1) ? "" : "es", ".\n";
     print STDERR "--  Will count kmers using $merylSegments jobs, each using $merylMemory GB and $thr threads.\n";
+    print STDERR "--  Each job counts one shard of the kmers from all reads.\n"   if ($merylShards > 0);
     print STDERR "--\n";
 
     setGlobal("merylMemory",  $merylMemory);
@@ -483,6 +467,33 @@ sub merylConfigure ($$) {
     print F "  exit 1\n";
     print F "fi\n";
     print F "\n";
+
+    if ($merylShards > 0) {
+        my $shardIndex = "./$asm.sharded.meryl/merylIndex.shard\$shardid-of-" . substr("00$merylShards", -3);
+
+        print F "shardid=`printf %03d \$jobid`\n";
+        print F "\n";
+        print F "#  If this shard of the meryl database exists, we're done.\n";
+        print F "\n";
+        print F "if [ -e $shardIndex ] ; then\n";
+        print F "  echo Kmers for shard \$jobid exist.\n";
+        print F "  exit 0\n";
+        print F "fi\n";
+        print F "\n";
+        print F fetchSeqStoreShellCode($asm, $path, "");
+        print F "\n";
+        print F "#  Count the kmers in this shard from all reads.  The last shard\n";
+        print F "#  to finish writes the merylIndex for the whole database.\n";
+        print F "\n";
+        print F "$bin/meryl k=$merSize threads=$thr memory=$merylMemory \\\n";
+        print F "  count \\\n";
+        print F "    shard=\$jobid/$merylSegments ../../$asm.seqStore \\\n";
+        print F "    output ./$asm.sharded.meryl\n";
+        print F "\n";
+        print F "exit 0\n";
+        goto countDone;
+    }
+
     print F "jobid=`printf %02d \$jobid`\n";
     print F "\n";
     print F "#  If the meryl database exists, we're done.\n";
@@ -520,6 +531,8 @@ sub merylConfigure ($$) {
 
     print F "\n";
     print F "exit 0\n";
+
+  countDone:
     close(F);
 
     makeExecutable("$path/meryl-count.sh");
@@ -583,8 +596,12 @@ sub merylConfigure ($$) {
     print F "  $bin/meryl threads=$thr memory=$merylMemory \\\n";
     print F "    greater-than 1 \\\n";
     print F "      output $name.WORKING \\\n";
-    print F "      union-sum  \\\n";
-    print F "        ./$asm.$_.meryl \\\n"   foreach (@jobs);   #  One line, yay, but not use of $_.
+    if ($merylShards > 0) {
+        print F "      ./$asm.sharded.meryl \\\n";
+    } else {
+        print F "      union-sum  \\\n";
+        print F "        ./$asm.$_.meryl \\\n"   foreach (@jobs);   #  One line, yay, but not use of $_.
+    }
     print F "  && \\\n";
     print F "  mv -f ./$name.WORKING ./$name\n";
     print F "\n";
@@ -595,6 +612,7 @@ sub merylConfigure ($$) {
     print F "  fi\n";
     print F "\n";
     print F "  #  Remove meryl intermediate files.\n";
+    print F "  rm -rf ./$asm.sharded.meryl\n"                      if ($merylShards > 0);
     print F "  rm -rf ./$asm.$_.meryl ./$asm.$_.meryl.err\n"       foreach (@jobs);   #  One line, yay, but not use of $_.
     print F "fi\n";
     print F "\n";
@@ -788,10 +806,15 @@ sub merylCountCheck ($$) {
     my $failureMessage = "";
 
     for (my $job=1; $job <= $jobs; $job++) {
+        my $shardIndex = sprintf("$path/$asm.sharded.meryl/merylIndex.shard%03d-of-%03d", $job, $jobs);
+
         if      ((fileExists("$path/$asm.$currentJobID.meryl")) ||
                  (fileExists("$path/$asm.$currentJobID.meryl.tar.gz"))) {
             push @successJobs, "$path/$asm.$currentJobID.meryl\n";
 
+        } elsif (fileExists($shardIndex)) {
+            push @successJobs, "$shardIndex\n";
+
         } else {
             $failureMessage .= "--   job $asm.$currentJobID.meryl FAILED.\n";
             push @failedJobs, $job;
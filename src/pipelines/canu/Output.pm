@@ -76,6 +76,7 @@ sub generateOutputs ($) {
             $cmd .= "  -T ./unitigging/$asm.ctgStore 2 \\\n";
             $cmd .= "  -o ./$asm.contigs \\\n";
             $cmd .= "  -layout \\\n";
+            $cmd .= "  -threads " . getGlobal("executiveThreads") . " \\\n";
             $cmd .= "> ./$asm.contigs.layout.err 2>&1";
 
             if (runCommand(".", $cmd)) {
@@ -103,6 +104,7 @@ sub generateOutputs ($) {
             $cmd .= "  -T ./unitigging/$asm.utgStore 2 \\\n";
             $cmd .= "  -o ./$asm.unitigs \\\n";
             $cmd .= "  -layout \\\n";
+            $cmd .= "  -threads " . getGlobal("executiveThreads") . " \\\n";
             $cmd .= "> ./$asm.unitigs.layout.err 2>&1";
 
             if (runCommand(".", $cmd)) {
@@ -129,6 +131,8 @@ sub generateOutputs ($) {
                 $cmd .= "  -S ./$asm.seqStore \\\n";
                 $cmd .= "  -T ./unitigging/$asm.ctgStore 2 \\\n";
                 $cmd .= "  -consensus -$type \\\n";
+            $cmd .= "  -threads " . getGlobal("executiveThreads") . " \\\n";
+                $cmd .= "  -threads " . getGlobal("executiveThreads") . " \\\n";
                 $cmd .= "  -$tt \\\n";
                 $cmd .= "> ./$asm.$tt.$type\n";
                 $cmd .= "2> ./$asm.$tt.err";
@@ -155,6 +159,7 @@ sub generateOutputs ($) {
             $cmd .= "  -S ./$asm.seqStore \\\n";
             $cmd .= "  -T ./unitigging/$asm.utgStore 2 \\\n";
             $cmd .= "  -consensus -$type \\\n";
+            $cmd .= "  -threads " . getGlobal("executiveThreads") . " \\\n";
             $cmd .= "  -contigs \\\n";
             $cmd .= "> ./$asm.unitigs.$type\n";
             $cmd .= "2> ./$asm.unitigs.err";
@@ -72,6 +72,9 @@ sub trimReads ($) {
 
     #  Previously, we'd pick the error rate used by unitigger.  Now, we don't know unitigger here,
     #  and require an obt specific error rate.
+    #
+    #  trimReads also splits the trimmed reads (the same as splitReads() below would) so that
+    #  the overlaps are loaded only once.
 
     $cmd  = "$bin/trimReads \\\n";
     $cmd .= "  -S  ../../$asm.seqStore \\\n";
@@ -82,7 +85,10 @@ sub trimReads ($) {
     #$cmd .= "  -Cm ./$asm.max.clear \\\n"          if (-e "./$asm.max.clear");
     $cmd .= "  -ol " . getGlobal("trimReadsOverlap") . " \\\n";
     $cmd .= "  -oc " . getGlobal("trimReadsCoverage") . " \\\n";
+    $cmd .= "  -threads " . getGlobal("executiveThreads") . " \\\n";
+    $cmd .= "  -M  " . getGlobal("executiveMemory") . " \\\n";
     $cmd .= "  -o  ./$asm.1.trimReads \\\n";
+    $cmd .= "  -split ./$asm.2.splitReads \\\n";
     $cmd .= ">     ./$asm.1.trimReads.err 2>&1";
 
     if (runCommand($path, $cmd)) {
@@ -90,10 +96,12 @@ sub trimReads ($) {
     }
 
     caFailure("trimReads finished, but no '$asm.1.trimReads.clear' output found", undef)  if (! -e "$path/$asm.1.trimReads.clear");
+    caFailure("trimReads finished, but no '$asm.2.splitReads.clear' output found", undef)  if (! -e "$path/$asm.2.splitReads.clear");
 
     unlink("$path/$asm.1.trimReads.err");
 
     stashFile("./trimming/3-overlapbasedtrimming/$asm.1.trimReads.clear");
+    stashFile("./trimming/3-overlapbasedtrimming/$asm.2.splitReads.clear");
 
     my $report;
 
@@ -106,6 +114,17 @@ sub trimReads ($) {
 
     addToReport("trimming", $report);
 
+    undef $report;
+
+#FORMAT
+    open(F, "< trimming/3-overlapbasedtrimming/$asm.2.splitReads.stats") or caExit("can't open 'trimming/3-overlapbasedtrimming/$asm.2.splitReads.stats' for reading: $!", undef);
+    while (<F>) {
+        $report .= "--  $_";
+    }
+    close(F);
+
+    addToReport("splitting", $report);
+
 
     if (0) {
         $cmd  = "$bin/sqStoreDumpFASTQ \\\n";
@@ -134,6 +153,8 @@ sub splitReads ($) {
     my $cmd;
     my $path   = "trimming/3-overlapbasedtrimming";
 
+    #  Usually done already, by trimReads() above.
+
     goto allDone   if (fileExists("trimming/3-overlapbasedtrimming/$asm.2.splitReads.clear"));
 
     make_path($path)  if (! -d $path);
@@ -154,6 +175,7 @@ sub splitReads ($) {
     $cmd .= "  -Co ./$asm.2.splitReads.clear \\\n";
     $cmd .= "  -e  $erate \\\n";
     $cmd .= "  -minlength " . getGlobal("minReadLength") . " \\\n";
+    $cmd .= "  -threads " . getGlobal("executiveThreads") . " \\\n";
     $cmd .= "  -o  ./$asm.2.splitReads \\\n";
     $cmd .= ">     ./$asm.2.splitReads.err 2>&1";
 
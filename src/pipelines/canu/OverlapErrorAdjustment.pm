@@ -139,6 +139,23 @@ sub loadReadLengthsAndNumberOfOverlaps ($$$$) {
 }
 
 
+#  An estimate of the cost of aligning every overlap:  the number of overlaps
+#  for each read times its length.  Never zero, so it can be divided by.
+
+sub computeWork ($$$) {
+    my $maxID   = shift @_;
+    my $rlVec   = shift @_;
+    my $noVec   = shift @_;
+    my $work    = 1;
+
+    for (my $id = 1; $id <= $maxID; $id++) {
+        $work += vec($noVec, $id, 32) * vec($rlVec, $id, 32)   if (vec($rlVec, $id, 32) > 0);
+    }
+
+    return($work);
+}
+
+
 sub readErrorDetectionConfigure ($) {
     my $asm     = shift @_;
     my $bin     = getBinDirectory();
@@ -184,17 +201,25 @@ sub readErrorDetectionConfigure ($) {
     print STDERR "--                                      ", ($maxBases > 0) ? $maxBases : "(unlimited)", " bases.\n";
     print STDERR "--                   Expecting evidence of at most $maxBlockSize bases per iteration.\n";
     print STDERR "--\n";
-    print STDERR "--           Total                                               Reads                 Olaps Evidence\n";
-    print STDERR "--    Job   Memory      Read Range         Reads        Bases   Memory        Olaps   Memory   Memory  (Memory in MB)\n";
-    print STDERR "--   ---- -------- ------------------- --------- ------------ -------- ------------ -------- --------\n";
+
+    #  Run time is closer to the number of overlaps times their length than
+    #  to either alone.  Partition once on memory alone, then again with
+    #  each job limited to an even share of the work.
+
+    my $workSum  = computeWork($maxID, $rlVec, $noVec);
+    my $maxWork  = 0;
+
+  tryREDagain:
+    my @bgn;   undef @bgn;
+    my @end;   undef @end;
+    my @log;   undef @log;
+
+    my $nj = 0;
 
     my $reads    = 0;
     my $bases    = 0;
     my $olaps    = 0;
-
-    my @bgn;
-    my @end;
-    my $nj = 0;
+    my $work     = 0;
 
     push @bgn, 1;
 
@@ -203,13 +228,14 @@ sub readErrorDetectionConfigure ($) {
             $reads += 1;
             $bases += vec($rlVec, $id, 32);
             $olaps += vec($noVec, $id, 32);
+            $work  += vec($noVec, $id, 32) * vec($rlVec, $id, 32);
         }
 
         #  Memory usage:
         #
         #  Per base/vote:
-        #    1 byte  for sequence
-        #   12 bytes for Vote_Tally_t
+        #   1/4 byte for sequence (2-bit packed)
+        #   10 bytes for Vote_Tally_t
         #
         #  Per read:
         #   32 bytes for Frag_Info_t
@@ -225,34 +251,50 @@ sub readErrorDetectionConfigure ($) {
         #
         #  Throw in another 2 GB for unknown overheads (seqStore, ovlStore) and alignment generation.
 
-        my $memory = (12 * $bases) + (33 * $reads) + (12 * $olaps) + (2 * $maxBlockSize) + 2 * 1024 * 1024 * 1024;
+        my $memory = (10.25 * $bases) + (33 * $reads) + (12 * $olaps) + (2 * $maxBlockSize) + 2 * 1024 * 1024 * 1024;
 
         if ((($maxMem   > 0) && ($memory >= $maxMem))    ||
             (($maxReads > 0) && ($reads  >= $maxReads))  ||
             (($maxBases > 0) && ($bases  >= $maxBases))  ||
+            (($maxWork  > 0) && ($work   >= $maxWork))   ||
             (($id == $maxID))) {
             push @end, $id;
 
-            printf(STDERR "--   %4u %8.2f %9u-%-9u %9u %12u %8.2f %12u %8.2f %8.2f\n",
-                   $nj + 1,
-                   $memory / 1024 / 1024,
-                   $bgn[$nj], $end[$nj],
-                   $reads,
-                   $bases,               (12 * $bases + 33 * $reads)  / 1024 / 1024,
-                   $olaps,               (12 * $olaps)                / 1024 / 1024,
-                   2 * $maxBlockSize / 1024 / 1024);
+            push @log, sprintf("--   %4u %8.2f %9u-%-9u %9u %12u %8.2f %12u %8.2f %8.2f %6.2f\n",
+                               $nj + 1,
+                               $memory / 1024 / 1024,
+                               $bgn[$nj], $end[$nj],
+                               $reads,
+                               $bases,               (10.25 * $bases + 33 * $reads)  / 1024 / 1024,
+                               $olaps,               (12 * $olaps)                / 1024 / 1024,
+                               2 * $maxBlockSize / 1024 / 1024,
+                               100.0 * $work / $workSum);
 
             $nj++;
 
             $reads = 0;
             $bases = 0;
             $olaps = 0;
+            $work  = 0;
 
             push @bgn, $id + 1;  #  RED expects inclusive ranges.
         }
     }
 
-    print  STDERR "--   ---- -------- ------------------- --------- ------------ -------- ------------ -------- --------\n";
+    if (($maxWork == 0) && ($nj > 1)) {
+        $maxWork = int($workSum / $nj) + 1;
+        goto tryREDagain;
+    }
+
+    print STDERR "--           Total                                               Reads                 Olaps Evidence   Work\n";
+    print STDERR "--    Job   Memory      Read Range         Reads        Bases   Memory        Olaps   Memory   Memory      %  (Memory in MB)\n";
+    print STDERR "--   ---- -------- ------------------- --------- ------------ -------- ------------ -------- -------- ------\n";
+
+    foreach my $l (@log) {
+        print STDERR $l;
+    }
+
+    print  STDERR "--   ---- -------- ------------------- --------- ------------ -------- ------------ -------- -------- ------\n";
     printf(STDERR "--                                               %12u          %12u\n",
            $rlSum, $noSum);
 
@@ -267,6 +309,7 @@ sub readErrorDetectionConfigure ($) {
     print F "\n";
     print F getBinDirectoryShellCode();
     print F "\n";
+    print F getStageShellCode();
     print F setWorkDirectoryShellCode($path);
     print F fetchSeqStoreShellCode($asm, $path, "");
     print F fetchOvlStoreShellCode($asm, $path, "");
@@ -288,8 +331,10 @@ sub readErrorDetectionConfigure ($) {
     print F "  exit\n";
     print F "fi\n";
     print F "\n";
+    print F stageStoreShellCode("seqStore", "../../$asm.seqStore", "");
+    print F "\n";
     print F "\$bin/findErrors \\\n";
-    print F "  -S ../../$asm.seqStore \\\n";
+    print F "  -S \$seqStore \\\n";
     print F "  -O ../$asm.ovlStore \\\n";
     print F "  -R \$minid \$maxid \\\n";
     print F "  -e " . getGlobal("utgOvlErrorRate") . " -l " . getGlobal("minOverlapLength") . " \\\n";
@@ -378,6 +423,8 @@ sub readErrorDetectionCheck ($) {
 
         generateReport($asm);
 
+        setGlobal("redStageSpace", getSizeOfSequenceStore($asm))   if (defined(getGlobal("stageCache")));
+
         submitOrRunParallelJob($asm, "red", $path, "red", @failedJobs);
         return;
     }
@@ -447,6 +494,10 @@ sub overlapErrorAdjustmentConfigure ($) {
     my ($rlSum, $noSum) = loadReadLengthsAndNumberOfOverlaps($asm, $maxID, \$rlVec, \$noVec);
 
     #  Make an array of partitions, putting as many reads into each as will fit in the desired memory.
+    #  As for RED, then partition again so each job gets an even share of the work.
+
+    my $workSum  = computeWork($maxID, $rlVec, $noVec);
+    my $maxWork  = 0;
 
   tryOEAagain:
     my @bgn;   undef @bgn;
@@ -458,6 +509,7 @@ sub overlapErrorAdjustmentConfigure ($) {
     my $maxMem   = getGlobal("oeaMemory") * 1024 * 1024 * 1024;
     my $maxReads = getGlobal("oeaBatchSize");
     my $maxBases = getGlobal("oeaBatchLength");
+    my $nThreads = getGlobal("oeaThreads");
 
     print STDERR "--\n";
     print STDERR "-- Configure OEA for ", getGlobal("oeaMemory"), "gb memory.\n";
@@ -468,6 +520,7 @@ sub overlapErrorAdjustmentConfigure ($) {
     my $reads    = 0;
     my $bases    = 0;
     my $olaps    = 0;
+    my $work     = 0;
 
     fetchFile("$path/red.red");
 
@@ -483,6 +536,7 @@ sub overlapErrorAdjustmentConfigure ($) {
             $reads += 1;
             $bases += vec($rlVec, $id, 32);
             $olaps += vec($noVec, $id, 32);
+            $work  += vec($noVec, $id, 32) * vec($rlVec, $id, 32);
         }
 
         #  OEA uses 1 byte/base + 8 bytes/adjustment + 28 bytes/overlap.  We don't know the number
@@ -491,12 +545,12 @@ sub overlapErrorAdjustmentConfigure ($) {
         #  Hacked to attempt to estimate adjustment size better.  Olaps should only require 12 bytes each.
 
         my $memBases  = (1    * $bases);              #  Corrected reads for this batch
-        my $memAdj1   = (8    * $corrSize) * 0.33;    #  Overestimate of the size of the indel adjustments needed (total size includes mismatches)
+        my $memAdj1   = (16   * $corrSize) * 0.33;    #  Overestimate of the size of the indel adjustments needed (total size includes mismatches; corrections are 4 bytes each)
         my $memReads  = (32   * $reads);              #  Read data in the batch
         my $memOlaps  = (32   * $olaps);              #  Loaded overlaps
-        my $memSeq    = (4    * 2097152);             #  two char arrays of 2*maxReadLen
-        my $memAdj2   = (16   * 2097152);             #  two Adjust_t arrays of maxReadLen
-        my $memWA     = (32   * 1048576);             #  Work area (16mb) and edit array (16mb)
+        my $memSeq    = (4    * 2097152) * $nThreads; #  two char arrays of 2*maxReadLen, per thread
+        my $memAdj2   = (16   * 2097152) * $nThreads; #  two Adjust_t arrays of maxReadLen, per thread
+        my $memWA     = (32   * 1048576) * $nThreads; #  Work area (16mb) and edit array (16mb), per thread
         my $memMisc   = (256  * 1048576);             #  Work area (16mb) and edit array (16mb) and (192mb) slop
         my $memExtra  = (2048 * 1048576);             #  For alignments and overhead.
 
@@ -505,6 +559,7 @@ sub overlapErrorAdjustmentConfigure ($) {
         if ((($maxMem   > 0) && ($memory >= $maxMem))   ||
             (($maxReads > 0) && ($reads  >= $maxReads)) ||
             (($maxBases > 0) && ($bases  >= $maxBases)) ||
+            (($maxWork  > 0) && ($work   >= $maxWork))  ||
             (($id == $maxID))) {
             push @end, $id;
 
@@ -512,7 +567,7 @@ sub overlapErrorAdjustmentConfigure ($) {
 
             #  Save the log for later printing.  We redo the configuration if there are too many small jobs.
 
-            push @log, sprintf("--   %4u %8.2f %9u-%-9u %9u %12u %8.2f %12u %8.2f %8.2f\n",
+            push @log, sprintf("--   %4u %8.2f %9u-%-9u %9u %12u %8.2f %12u %8.2f %8.2f %6.2f\n",
                                $nj + 1,
                                $memory / 1024 / 1024,
                                $bgn[$nj], $end[$nj],
@@ -520,13 +575,15 @@ sub overlapErrorAdjustmentConfigure ($) {
                                ($memReads + $memBases + $memSeq) / 1024 / 1024,
                                $olaps,
                                $memOlaps / 1024 / 1024,
-                               ($memAdj1 + $memAdj2 + $memWA + $memMisc) / 1024 / 1024);
+                               ($memAdj1 + $memAdj2 + $memWA + $memMisc) / 1024 / 1024,
+                               100.0 * $work / $workSum);
 
             $nj++;
 
             $reads = 0;
             $bases = 0;
             $olaps = 0;
+            $work  = 0;
 
             push @bgn, $id + 1;  #  OEA expects inclusive ranges.
         }
@@ -543,20 +600,27 @@ sub overlapErrorAdjustmentConfigure ($) {
 
         setGlobal("oeaMemory", $newMem);
 
+        $maxWork = 0;
+
+        goto tryOEAagain;
+    }
+
+    if (($maxWork == 0) && ($nj > 1)) {
+        $maxWork = int($workSum / $nj) + 1;
         goto tryOEAagain;
     }
 
     #  Report.
 
-    print STDERR "--           Total                                               Reads                 Olaps  Adjusts\n";
-    print STDERR "--    Job   Memory      Read Range         Reads        Bases   Memory        Olaps   Memory   Memory  (Memory in MB)\n";
-    print STDERR "--   ---- -------- ------------------- --------- ------------ -------- ------------ -------- --------\n";
+    print STDERR "--           Total                                               Reads                 Olaps  Adjusts   Work\n";
+    print STDERR "--    Job   Memory      Read Range         Reads        Bases   Memory        Olaps   Memory   Memory      %  (Memory in MB)\n";
+    print STDERR "--   ---- -------- ------------------- --------- ------------ -------- ------------ -------- -------- ------\n";
 
     foreach my $l (@log) {
         print STDERR $l;
     }
 
-    print  STDERR "--   ---- -------- ------------------- --------- ------------ -------- ------------ -------- --------\n";
+    print  STDERR "--   ---- -------- ------------------- --------- ------------ -------- ------------ -------- -------- ------\n";
     printf(STDERR "--                                               %12u          %12u\n",
            $rlSum, $noSum);
 
@@ -568,6 +632,7 @@ sub overlapErrorAdjustmentConfigure ($) {
     print F "\n";
     print F getBinDirectoryShellCode();
     print F "\n";
+    print F getStageShellCode();
     print F setWorkDirectoryShellCode($path);
     print F fetchSeqStoreShellCode($asm, $path, "");
     print F fetchOvlStoreShellCode($asm, $path, "");
@@ -591,13 +656,16 @@ sub overlapErrorAdjustmentConfigure ($) {
     print F "\n";
     print F fetchFileShellCode("unitigging/3-overlapErrorAdjustment", "red.red", "");
     print F "\n";
+    print F stageStoreShellCode("seqStore", "../../$asm.seqStore", "");
+    print F "\n";
     print F "\$bin/correctOverlaps \\\n";
-    print F "  -S ../../$asm.seqStore \\\n";
+    print F "  -S \$seqStore \\\n";
     print F "  -O ../$asm.ovlStore \\\n";
     print F "  -R \$minid \$maxid \\\n";
     print F "  -e " . getGlobal("utgOvlErrorRate") . " -l " . getGlobal("minOverlapLength") . " \\\n";
     print F "  -c ./red.red \\\n";
     print F "  -o ./\$jobid.oea.WORKING \\\n";
+    print F "  -t " . getGlobal("oeaThreads") . " \\\n";
     print F "&& \\\n";
     print F "mv ./\$jobid.oea.WORKING ./\$jobid.oea\n";
     print F "\n";
@@ -686,6 +754,8 @@ sub overlapErrorAdjustmentCheck ($) {
 
         generateReport($asm);
 
+        setGlobal("oeaStageSpace", getSizeOfSequenceStore($asm))   if (defined(getGlobal("stageCache")));
+
         submitOrRunParallelJob($asm, "oea", $path, "oea", @failedJobs);
         return;
     }
@@ -50,6 +50,7 @@ use File::Path 2.08 qw(make_path remove_tree);
 
 use canu::Defaults;
 use canu::Execution;
+use canu::SequenceStore;
 
 use canu::Report;
 
@@ -115,6 +116,7 @@ sub overlapConfigure ($$$) {
         $cmd .= " -hl " . getGlobal("${tag}OvlHashBlockLength") . " \\\n";
         $cmd .= " -rl " . getGlobal("${tag}OvlRefBlockLength")  . " \\\n";
         $cmd .= " -ol " . getGlobal("minOverlapLength") . " \\\n";
+        $cmd .= " -sample " . getGlobal("${tag}OvlPartitionSample") . " -k " . getGlobal("${tag}OvlMerSize") . " \\\n"  if (defined(getGlobal("${tag}OvlPartitionSample")));
         $cmd .= " -o  ./$asm.partition \\\n";
         $cmd .= "> ./$asm.partition.err 2>&1";
 
@@ -125,6 +127,7 @@ sub overlapConfigure ($$$) {
         stashFile("$path/$asm.partition.ovlbat");
         stashFile("$path/$asm.partition.ovljob");
         stashFile("$path/$asm.partition.ovlopt");
+        stashFile("$path/$asm.partition.ovlcost")  if (-e "$path/$asm.partition.ovlcost");
 
         unlink "$path/overlap.sh";
     }
@@ -158,6 +161,7 @@ sub overlapConfigure ($$$) {
         print F "\n";
         print F getBinDirectoryShellCode();
         print F "\n";
+        print F getStageShellCode();
         print F setWorkDirectoryShellCode($path);
         print F fetchSeqStoreShellCode($asm, $path, "");
         print F "\n";
@@ -192,6 +196,7 @@ sub overlapConfigure ($$$) {
         print F "  cd -\n";
         print F "fi\n";
         print F "\n";
+        print F stageStoreShellCode("seqStore", "../../$asm.seqStore", "");
         print F "\n";
         print F "\$bin/overlapInCore \\\n";
         print F "  -partial \\\n"  if ($type eq "partial");
@@ -200,17 +205,19 @@ sub overlapConfigure ($$$) {
         print F "  -k ../0-mercounts/$asm.ms$merSize.dump \\\n";
         print F "  --hashbits $hashBits \\\n";
         print F "  --hashload $hashLoad \\\n";
+        print F "  --hashcache ", getGlobal("${tag}OvlHashCache"), "/$asm.$tag \\\n"  if (defined(getGlobal("${tag}OvlHashCache")));
         print F "  --maxerate  ", getGlobal("corOvlErrorRate"), " \\\n"  if ($tag eq "cor");   #  Explicitly using proper name for grepability.
         print F "  --maxerate  ", getGlobal("obtOvlErrorRate"), " \\\n"  if ($tag eq "obt");
         print F "  --maxerate  ", getGlobal("utgOvlErrorRate"), " \\\n"  if ($tag eq "utg");
         print F "  --minlength ", getGlobal("minOverlapLength"), " \\\n";
         print F "  --minkmers \\\n" if (defined(getGlobal("${tag}OvlFilter")) && getGlobal("${tag}OvlFilter")==1);
         print F "  \$opt \\\n";
+        print F "  --ranges ", getGlobal("ovsRanges"), " \\\n"  if (getGlobal("ovsRanges") > 0);
         print F "  -o ./\$job.ovb.WORKING \\\n";
         print F "  -s ./\$job.stats \\\n";
         #print F "  -H $hashLibrary \\\n" if ($hashLibrary ne "0");
         #print F "  -R $refLibrary \\\n"  if ($refLibrary  ne "0");
-        print F "  ../../$asm.seqStore \\\n";
+        print F "  \$seqStore \\\n";
         print F "&& \\\n";
         print F "mv ./\$job.ovb.WORKING ./\$job.ovb\n";
         print F "\n";
@@ -413,6 +420,8 @@ sub overlapCheck ($$$) {
 
         generateReport($asm);
 
+        setGlobal("${tag}ovlStageSpace", getSizeOfSequenceStore($asm))   if (defined(getGlobal("stageCache")));
+
         submitOrRunParallelJob($asm, "${tag}ovl", $path, "overlap", @failedJobs);
         return;
     }
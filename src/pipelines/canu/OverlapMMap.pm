@@ -392,6 +392,8 @@ sub mmapConfigure ($$$) {
     print F "    -e " . getGlobal("${tag}OvlErrorRate");
     print F "    -partial \\\n"  if ($typ eq "partial");
     print F "    -len "  , getGlobal("minOverlapLength"),  " \\\n";
+    print F "    -t "    , getGlobal("${tag}mmapThreads"), " \\\n";
+    print F "    -ranges ", getGlobal("ovsRanges"), " \\\n"   if ((getGlobal("ovsRanges") > 0) && (getGlobal("${tag}ReAlign") ne "1"));
     print F "    ./results/\$qry.mmap \\\n";
     print F "  && \\\n";
     print F "  mv ./results/\$qry.mmap.ovb.WORKING ./results/\$qry.mmap.ovb\n";
@@ -495,6 +495,8 @@ sub mhapConfigure ($$$) {
     print F "  \$bin/mhapConvert \\\n";
     print F "    -S ../../$asm.seqStore \\\n";
     print F "    -o ./results/\$qry.mhap.ovb.WORKING \\\n";
+    print F "    -t ", getGlobal("${tag}mhapThreads"), " \\\n";
+    print F "    -ranges ", getGlobal("ovsRanges"), " \\\n"   if ((getGlobal("ovsRanges") > 0) && (getGlobal("${tag}ReAlign") ne "1"));
     print F "    ./results/\$qry.mhap \\\n";
     print F "  && \\\n";
     print F "  mv ./results/\$qry.mhap.ovb.WORKING ./results/\$qry.mhap.ovb\n";
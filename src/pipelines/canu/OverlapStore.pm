@@ -49,6 +49,7 @@ no  warnings "uninitialized";
 use File::Basename;   #  dirname
 use File::Path 2.08 qw(make_path remove_tree);
 use POSIX qw(ceil);
+use List::Util qw(min);
 
 use canu::Defaults;
 use canu::Execution;
@@ -62,6 +63,9 @@ use canu::Grid_Cloud;
 #  Parallel documentation: Each overlap job is converted into a single bucket of overlaps.  Within
 #  each bucket, the overlaps are distributed into many slices, one per sort job.  The sort jobs then
 #  load the same slice from each bucket.
+#
+#  With ovsRanges set, each overlap job writes its own bucket, split into that many fixed ranges of
+#  reads, and slices are made from whole ranges.  There is nothing for the bucketizer to do.
 
 
 #  NOT FILTERING overlaps by error rate when building the parallel store.
@@ -164,6 +168,7 @@ sub createOverlapStoreSequential ($$$) {
         print F " -O  ./$asm.ovlStore.BUILDING \\\n";
         print F" -S ../$asm.seqStore \\\n";
         print F " -C  ./$asm.ovlStore.config \\\n";
+        print F " -threads " . getGlobal("ovsThreads") . " \\\n";
         print F " > ./$asm.ovlStore.err 2>&1 \\\n";
         print F "&& \\\n";
         print F "mv ./$asm.ovlStore.BUILDING ./$asm.ovlStore\n";
@@ -724,6 +729,128 @@ sub deleteOverlapIntermediateFiles ($$) {
 
 
 
+#  Estimate how long the sequential and parallel methods will take, and
+#  return the faster.  The estimate is crude: a fixed cost per round of
+#  jobs, plus I/O at a fixed rate per stream, plus sorting at a fixed rate
+#  per thread.  Aggregate bandwidth grows with the number of jobs only on a
+#  parallel filesystem.
+#
+sub chooseOverlapStoreMethod ($$$$$) {
+    my $base        = shift @_;
+    my $asm         = shift @_;
+    my $numBuckets  = shift @_;
+    my $numSlices   = shift @_;
+    my $numOverlaps = shift @_;
+
+    my $method      = getGlobal("ovsMethod");
+
+    #  If the user told us, or if a build was already started, that's that.
+
+    if (defined($method)) {
+        caExit("invalid ovsMethod '$method'; must be 'sequential' or 'parallel'", undef)
+            if (($method ne "sequential") && ($method ne "parallel"));
+
+        print STDERR "--   method '$method' (from ovsMethod)\n";
+        return($method);
+    }
+
+    if (-e "$base/$asm.ovlStore.BUILDING/scripts/1-bucketize.sh") {
+        print STDERR "--   method 'parallel' (resuming)\n";
+        return("parallel");
+    }
+
+    if (-e "$base/$asm.ovlStore.sh") {
+        print STDERR "--   method 'sequential' (resuming)\n";
+        return("sequential");
+    }
+
+    #  Without an overlap count (an old config), fall back to the old rule.
+
+    if ($numOverlaps == 0) {
+        $method = ($numSlices == 1) ? "sequential" : "parallel";
+
+        print STDERR "--   method '$method'\n";
+        return($method);
+    }
+
+    #  Bytes read from overlapper outputs, spilled to buckets and written to
+    #  the store.
+
+    my $inputBytes = 0;
+
+    if (open(F, "< $base/1-overlapper/ovljob.files")) {
+        while (<F>) {
+            chomp;
+            $inputBytes += -s "$base/$_"   if (-e "$base/$_");
+        }
+        close(F);
+    }
+
+    $inputBytes = $numOverlaps * 4.5   if ($inputBytes == 0);
+
+    my $spillBytes = $numOverlaps * 10;
+    my $storeBytes = $numOverlaps * 20;
+
+    my $streamRate = 200 * 1024 * 1024;    #  Bytes per second, one job.
+    my $sortRate   = 2000000;              #  Overlaps per second, one thread.
+
+    #  Does bandwidth scale with jobs?
+
+    my $fsType   = `stat -f -c %T "$base" 2> /dev/null`;
+    my $fsScales = ($fsType =~ m/lustre|gpfs|beegfs|panfs|ceph|weka/i) ? 1 : 0;
+
+    chomp $fsType;
+
+    #  How many bucketizer and sorter jobs run at once, and how long it takes
+    #  to get a round of jobs going.
+
+    my $onGrid = 0;
+    my $jobsB  = $numBuckets;
+    my $jobsS  = $numSlices;
+
+    $onGrid = 1   if (defined(getGlobal("gridEngine")) &&
+                      (getGlobal("useGrid")    eq "1") &&
+                      (getGlobal("useGridOVB") eq "1") &&
+                      (getGlobal("useGridOVS") eq "1"));
+
+    if ($onGrid == 0) {
+        my $maxT = getGlobal("maxThreads");
+        my $maxM = getGlobal("maxMemory");
+
+        $jobsB = min($jobsB, int($maxT / getGlobal("ovbThreads")), int($maxM / getGlobal("ovbMemory")));
+        $jobsS = min($jobsS, int($maxT / getGlobal("ovsThreads")), int($maxM / getGlobal("ovsMemory")));
+    }
+
+    $jobsB = 1   if ($jobsB < 1);
+    $jobsS = 1   if ($jobsS < 1);
+
+    my $overhead = ($onGrid) ? 120 : 1;
+
+    my $bwB = $streamRate * (($fsScales) ? $jobsB : min($jobsB, 2));
+    my $bwS = $streamRate * (($fsScales) ? $jobsS : min($jobsS, 2));
+
+    my $seqTime = ($overhead +
+                   $inputBytes / $streamRate +
+                   (($numSlices > 1) ? 2 * $spillBytes / $streamRate : 0) +
+                   $numOverlaps / ($sortRate * getGlobal("ovsThreads")) +
+                   $storeBytes / $streamRate);
+
+    my $parTime = (3 * $overhead +
+                   ($inputBytes + $spillBytes) / $bwB +
+                   ($spillBytes + $storeBytes) / $bwS +
+                   $numOverlaps / ($sortRate * $jobsS));
+
+    $method = ($seqTime <= $parTime) ? "sequential" : "parallel";
+
+    printf STDERR "--   estimated %d seconds sequential, %d seconds parallel (%d bucketizer and %d sorter jobs at once%s; %s filesystem)\n",
+        $seqTime, $parTime, $jobsB, $jobsS, ($onGrid) ? " on the grid" : "", ($fsType eq "") ? "unknown" : $fsType;
+    print  STDERR "--   method '$method'\n";
+
+    return($method);
+}
+
+
+
 sub createOverlapStore ($$) {
     my $asm     = shift @_;
     my $tag     = shift @_;
@@ -792,29 +919,48 @@ sub createOverlapStore ($$) {
         stashFile("$base/$asm.ovlStore.config.txt");
     }
 
-    my $numBuckets = 0;
-    my $numSlices  = 0;
-    my $sortMemory = 0;
+    my $numBuckets  = 0;
+    my $numSlices   = 0;
+    my $sortMemory  = 0;
+    my $numOverlaps = 0;
+    my $numRanges   = 0;
 
     open(F, "< $base/$asm.ovlStore.config.txt") or caExit("can't open '$base/$asm.ovlStore.config.txt' for reading: $!\n", undef);
     while (<F>) {
-        $numBuckets = $1  if (m/numBuckets\s+(\d+)/);
-        $numSlices  = $1  if (m/numSlices\s+(\d+)/);
-        $sortMemory = $1  if (m/sortMemory\s+(\d+)\s+GB/);
+        $numBuckets  = $1  if (m/numBuckets\s+(\d+)/);
+        $numSlices   = $1  if (m/numSlices\s+(\d+)/);
+        $sortMemory  = $1  if (m/sortMemory\s+(\d+)\s+GB/);
+        $numOverlaps = $1  if (m/numOverlaps\s+(\d+)/);
+        $numRanges   = $1  if (m/numRanges\s+(\d+)/);
     }
     close(F);
 
     printf STDERR "--\n";
     printf STDERR "-- Creating overlap store $base/$asm.ovlStore using:\n";
-    printf STDERR "--   %4d bucket%s\n", $numBuckets, ($numBuckets == 1) ? "" : "s";
+    printf STDERR "--   %4d bucket%s\n", $numBuckets, ($numBuckets == 1) ? "" : "s"   if ($numRanges == 0);
+    printf STDERR "--   %4d read ranges, written directly by the overlapper\n", $numRanges   if ($numRanges > 0);
     printf STDERR "--   %4d slice%s\n",  $numSlices,  ($numSlices  == 1) ? "" : "s";
     printf STDERR "--        using at most %d GB memory each\n", $sortMemory;
 
     setGlobal("ovsMemory", $sortMemory + 2);  #  Actual memory usage of sort jobs (rounded up).
 
-    #  If only one slice, do it all in core, otherwise, use the big gun and run it in parallel.
+    #  Build it with one job, or with the big gun in parallel, whichever looks faster.
+
+    #  If the overlapper wrote buckets, there's only one way.
+
+    my $method;
+
+    if ($numRanges > 0) {
+        caExit("ovsMethod=sequential can't be used when overlaps are written as buckets (ovsRanges=$numRanges)", undef)
+            if (getGlobal("ovsMethod") eq "sequential");
+
+        $method = "parallel";
+        print STDERR "--   method 'parallel' (overlapper outputs are buckets)\n";
+    } else {
+        $method = chooseOverlapStoreMethod($base, $asm, $numBuckets, $numSlices, $numOverlaps);
+    }
 
-    if ($numSlices == 1) {
+    if ($method eq "sequential") {
         createOverlapStoreSequential($base, $asm, $tag);
         overlapStoreCheck           ($base, $asm, $tag)   foreach (1..getGlobal("canuIterationMax") + 1);
     }
@@ -871,6 +1017,7 @@ sub createOverlapStore ($$) {
         $cmd .= " -S ../$asm.seqStore \\\n";
         $cmd .= " -O  ./$asm.ovlStore \\\n";
         $cmd .= " -o  ./$asm.ovlStore \\\n";
+        $cmd .= " -threads " . getGlobal("ovsThreads") . " \\\n";
         $cmd .= " > ./$asm.ovlStore.summary.err 2>&1";
 
         if (runCommand($base, $cmd)) {
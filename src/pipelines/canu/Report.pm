@@ -40,6 +40,9 @@ no  warnings "uninitialized";
 #use canu::Defaults;
 use canu::Grid_Cloud;
 
+use Cwd qw(abs_path);
+use List::Util qw(min);
+
 
 #  Holds the report we have so far (loaded from disk) and is then populated with
 #  any new results and written back to disk.
@@ -90,6 +93,8 @@ sub loadReport ($) {
         } elsif (m/CONTIGS\]$/)      {  $rpt = "contigs";         $report{$rpt} = undef;
         } elsif (m/CONSENSUS\]$/)    {  $rpt = "consensus";       $report{$rpt} = undef;
 
+        } elsif (m/PERFORMANCE\]$/)  {  $rpt = "performance";     $report{$rpt} = undef;
+
         } else {
             $report{$rpt} .= $_;
         }
@@ -141,6 +146,8 @@ sub saveReport ($) {
     saveReportItem("UNITIGGING/CONTIGS",     $report{"contigs"});
     saveReportItem("UNITIGGING/CONSENSUS",   $report{"consensus"});
 
+    saveReportItem("PERFORMANCE",            $report{"performance"});
+
     close(F);
 
     stashFile("$asm.report");
@@ -148,10 +155,359 @@ sub saveReport ($) {
 
 
 
+#  Summarize the performance counter files the binaries write into
+#  canu-perf/ (see src/utility/perfCounters.C).
+#
+#  Per program: the number of runs, total wall and CPU time and the largest
+#  memory used; then the counters that took the most time over all programs.
+#
+#  Per stage (the directory, relative to the assembly, a program ran in):
+#  elapsed time, which stages the run spent most of its time in, the slowest
+#  jobs, how much of the memory and threads reserved for the jobs went unused
+#  (from the '*.resources' files submitOrRunParallelJob() leaves),
+#  throughput, and, if allocationProfile was set, allocations and the call
+#  sites that allocated the most.
+#
+#  The files are JSON, but written one item per line so we can get away
+#  with regular expressions here.
+
+sub loadPerformance ($) {
+    my $dir  = shift @_;
+    my @runs;
+
+    open(L, "ls $dir/*.json 2> /dev/null |");
+    while (<L>) {
+        chomp;
+
+        next   if (m/\.trace\.json$/);
+
+        my %r = ( "file" => $_, "counters" => [], "allocSites" => [] );
+
+        $r{"startTime"} = $1   if (m!/(\d+)_[^/]*$!);     #  Older files have no startTime.
+
+        open(J, "< $_") or next;
+        while (<J>) {
+            if (m/^\s*"(program|directory)":\s*"(.*)",$/)                                             { $r{$1} = $2; }
+            if (m/^\s*"(startTime|wallSeconds|cpuSeconds|maxMemoryBytes|bytesRead|bytesWritten)":\s*([0-9.]+),$/)  { $r{$1} = $2; }
+
+            if (m/^\s*"(allocCalls|allocBytes|allocPeakBytes)":\s*([0-9]+),$/)                       { $r{$1} = $2; }
+
+            if (m/"name":\s*"(.*)",\s*"calls":\s*(\d+),.*"seconds":\s*([0-9.]+),/) {
+                push @{$r{"counters"}}, [ $1, $2, $3 ];
+            }
+
+            if (m/"site":\s*"(.*)",\s*"samples":\s*(\d+),\s*"bytes":\s*(\d+)/) {
+                push @{$r{"allocSites"}}, [ $1, $2, $3 ];
+            }
+        }
+        close(J);
+
+        push @runs, \%r   if (defined($r{"program"}));
+    }
+    close(L);
+
+    return(@runs);
+}
+
+
+
+#  Total length of a list of [bgn, end] intervals, counting overlaps once.
+
+sub intervalUnion (@) {
+    my $len = 0;
+    my ($bgn, $end);
+
+    foreach my $i (sort { $a->[0] <=> $b->[0] } @_) {
+        if      (!defined($bgn)) {
+            ($bgn, $end) = @$i;
+        } elsif ($i->[0] <= $end) {
+            $end = $i->[1]   if ($end < $i->[1]);
+        } else {
+            $len += $end - $bgn;
+            ($bgn, $end) = @$i;
+        }
+    }
+
+    $len += $end - $bgn   if (defined($bgn));
+
+    return($len);
+}
+
+
+
+sub summarizePerformance () {
+    my $base = abs_path($ENV{'CANU_DIRECTORY'});
+    my $dir  = "$ENV{'CANU_DIRECTORY'}/canu-perf";
+    my %runs;
+    my %wall;
+    my %cpu;
+    my %mem;
+    my %cSec;
+    my %cCalls;
+
+    return   if (! -d $dir);
+
+    my @runs = loadPerformance($dir);
+
+    return   if (scalar(@runs) == 0);
+
+    foreach my $r (@runs) {
+        my $prog = $r->{"program"};
+
+        $runs{$prog}++;
+        $wall{$prog} += $r->{"wallSeconds"};
+        $cpu{$prog}  += $r->{"cpuSeconds"};
+        $mem{$prog}   = $r->{"maxMemoryBytes"}   if ($mem{$prog} < $r->{"maxMemoryBytes"});
+
+        foreach my $c (@{$r->{"counters"}}) {
+            $cCalls{$c->[0]} += $c->[1];
+            $cSec{$c->[0]}   += $c->[2];
+        }
+    }
+
+    my $text;
+
+    $text .= "--\n";
+    $text .= "-- Performance by program:\n";
+    $text .= "--\n";
+    $text .= "--  program                       runs    wall-hours     cpu-hours   max-mem-GB\n";
+    $text .= "--  ------------------------- ------- ------------- ------------- ------------\n";
+
+    foreach my $p (sort { $cpu{$b} <=> $cpu{$a} } keys %runs) {
+        $text .= sprintf("--  %-25s %7d %13.3f %13.3f %12.3f\n",
+                         $p, $runs{$p}, $wall{$p} / 3600, $cpu{$p} / 3600, $mem{$p} / 1024 / 1024 / 1024);
+    }
+
+    if (scalar(keys %cSec) > 0) {
+        $text .= "--\n";
+        $text .= "-- Most expensive counters (summed over threads):\n";
+        $text .= "--\n";
+        $text .= "--  counter                                      calls     thread-hours\n";
+        $text .= "--  ---------------------------------- --------------- ----------------\n";
+
+        my $n = 0;
+
+        foreach my $c (sort { $cSec{$b} <=> $cSec{$a} } keys %cSec) {
+            last   if (++$n > 20);
+
+            $text .= sprintf("--  %-34s %15d %16.3f\n", $c, $cCalls{$c}, $cSec{$c} / 3600);
+        }
+    }
+
+    #  Group runs into stages.  Anything run outside the assembly directory
+    #  is lumped together.
+
+    my %stages;
+
+    foreach my $r (@runs) {
+        my $d = $r->{"directory"};
+
+        if    (!defined($d))          { $d = "(unknown)"; }
+        elsif ($d eq $base)           { $d = "."; }
+        elsif ($d =~ m!^\Q$base\E/!)  { $d = substr($d, length($base) + 1); }
+        else                          { $d = "(elsewhere)"; }
+
+        $r->{"stage"} = $d;
+
+        push @{$stages{$d}}, $r;
+    }
+
+    #  Per stage: when it started, how long it ran (overlapping jobs counted
+    #  once), the longest job, and totals.
+
+    my (%sBgn, %sElapsed, %sLongest, %sCPU, %sWall, %sRead, %sWrite);
+    my @all;
+
+    foreach my $s (keys %stages) {
+        my @iv;
+
+        foreach my $r (@{$stages{$s}}) {
+            my $bgn = $r->{"startTime"};
+            my $end = $bgn + $r->{"wallSeconds"};
+
+            push @iv,  [ $bgn, $end ];
+            push @all, [ $bgn, $end ];
+
+            $sBgn{$s}     = $bgn                  if ((!defined($sBgn{$s})) || ($bgn < $sBgn{$s}));
+            $sLongest{$s} = $r->{"wallSeconds"}   if ($sLongest{$s} < $r->{"wallSeconds"});
+            $sWall{$s}   += $r->{"wallSeconds"};
+            $sCPU{$s}    += $r->{"cpuSeconds"};
+            $sRead{$s}   += $r->{"bytesRead"};
+            $sWrite{$s}  += $r->{"bytesWritten"};
+        }
+
+        $sElapsed{$s} = intervalUnion(@iv);
+    }
+
+    my $total = intervalUnion(@all);
+
+    $total = 1   if ($total == 0);
+
+    $text .= "--\n";
+    $text .= "-- Performance by stage, in the order they started:\n";
+    $text .= "--   elapsed     - time any job in the stage was running\n";
+    $text .= "--   longest     - the slowest job; the stage can't finish faster than it\n";
+    $text .= "--   parallelism - cpu-hours / elapsed-hours\n";
+    $text .= "--\n";
+    $text .= "--  stage                            jobs elapsed-hours  %-run longest-hours     cpu-hours parallelism  read-GB write-GB   MB/sec\n";
+    $text .= "--  ------------------------------ ------ ------------- ------ ------------- ------------- ----------- -------- -------- --------\n";
+
+    foreach my $s (sort { $sBgn{$a} <=> $sBgn{$b} } keys %stages) {
+        my $el = ($sElapsed{$s} > 0) ? $sElapsed{$s} : 1;
+
+        $text .= sprintf("--  %-30s %6d %13.3f %5.1f%% %13.3f %13.3f %11.2f %8.2f %8.2f %8.2f\n",
+                         $s, scalar(@{$stages{$s}}),
+                         $sElapsed{$s} / 3600, 100.0 * $sElapsed{$s} / $total,
+                         $sLongest{$s} / 3600, $sCPU{$s} / 3600, $sCPU{$s} / $el,
+                         $sRead{$s}  / 1024 / 1024 / 1024,
+                         $sWrite{$s} / 1024 / 1024 / 1024,
+                         ($sRead{$s} + $sWrite{$s}) / 1024 / 1024 / $el);
+    }
+
+    #  The stages that make up most of the elapsed time.  Stages run one
+    #  after another, so these are where a faster run has to come from.
+
+    my @critical;
+    my $covered = 0;
+
+    foreach my $s (sort { $sElapsed{$b} <=> $sElapsed{$a} } keys %stages) {
+        last   if ($covered >= 0.8 * $total);
+
+        push @critical, $s;
+        $covered += $sElapsed{$s};
+    }
+
+    $text .= "--\n";
+    $text .= sprintf("-- Critical path: %s (%.1f%% of %.3f elapsed hours).\n",
+                     join(", ", @critical), 100.0 * $covered / $total, $total / 3600);
+
+    #  The slowest jobs.
+
+    $text .= "--\n";
+    $text .= "-- Slowest jobs:\n";
+    $text .= "--\n";
+    $text .= "--  stage                          program                      wall-hours     cpu-hours   max-mem-GB\n";
+    $text .= "--  ------------------------------ ------------------------- ------------- ------------- ------------\n";
+
+    my $n = 0;
+
+    foreach my $r (sort { $b->{"wallSeconds"} <=> $a->{"wallSeconds"} } @runs) {
+        last   if (++$n > 10);
+
+        $text .= sprintf("--  %-30s %-25s %13.3f %13.3f %12.3f\n",
+                         $r->{"stage"}, $r->{"program"},
+                         $r->{"wallSeconds"} / 3600, $r->{"cpuSeconds"} / 3600,
+                         $r->{"maxMemoryBytes"} / 1024 / 1024 / 1024);
+    }
+
+    #  Reserved but unused memory and threads, for stages we know the
+    #  reservation for.  A job holds its reservation for as long as it runs,
+    #  so waste is in GB-hours and core-hours.
+
+    my $wasteText;
+
+    foreach my $s (sort { $sBgn{$a} <=> $sBgn{$b} } keys %stages) {
+        my ($type, $rMem, $rThr);
+
+        open(R, "ls $base/$s/*.resources 2> /dev/null |");
+        while (<R>) {
+            chomp;
+
+            if (open(F, "< $_")) {
+                ($type, $rMem, $rThr) = split '\s+', <F>;
+                close(F);
+            }
+        }
+        close(R);
+
+        next   if (!defined($rThr));
+
+        my ($memRes, $memUsed, $thrRes, $thrUsed) = (0, 0, 0, 0);
+
+        foreach my $r (@{$stages{$s}}) {
+            my $mu = $r->{"maxMemoryBytes"} / 1024 / 1024 / 1024;
+            my $wh = $r->{"wallSeconds"} / 3600;
+
+            $mu = $rMem   if ($mu > $rMem);     #  Over-use isn't negative waste.
+
+            $memRes  += $rMem * $wh;
+            $memUsed += $mu   * $wh;
+            $thrRes  += $rThr * $wh;
+            $thrUsed += min($rThr * $wh, $r->{"cpuSeconds"} / 3600);
+        }
+
+        $memRes = 1   if ($memRes == 0);
+        $thrRes = 1   if ($thrRes == 0);
+
+        $wasteText .= sprintf("--  %-30s %-5s %8.1f %4d %15.3f %5.1f%% %14.3f %5.1f%%\n",
+                              $s, $type, $rMem, $rThr,
+                              $memRes - $memUsed, 100.0 * ($memRes - $memUsed) / $memRes,
+                              $thrRes - $thrUsed, 100.0 * ($thrRes - $thrUsed) / $thrRes);
+    }
+
+    if (defined($wasteText)) {
+        $text .= "--\n";
+        $text .= "-- Unused reservations (reserved for the life of the job, but never used):\n";
+        $text .= "--\n";
+        $text .= "--                                        reserved\n";
+        $text .= "--  stage                          type   mem-GB  thr unused-GB-hours      % unused-cpu-hrs      %\n";
+        $text .= "--  ------------------------------ ----- -------- ---- --------------- ------ -------------- ------\n";
+        $text .= $wasteText;
+    }
+
+    #  Allocations, if any job profiled them (see src/utility/allocProfile.H).
+    #  Sampled bytes for the same call site are summed over all jobs in the
+    #  stage.
+
+    my $allocText;
+
+    foreach my $s (sort { $sBgn{$a} <=> $sBgn{$b} } keys %stages) {
+        my ($calls, $bytes, $peak, %site) = (0, 0, 0);
+
+        foreach my $r (@{$stages{$s}}) {
+            next   if (!defined($r->{"allocCalls"}));
+
+            $calls += $r->{"allocCalls"};
+            $bytes += $r->{"allocBytes"};
+            $peak   = $r->{"allocPeakBytes"}   if ($peak < $r->{"allocPeakBytes"});
+
+            foreach my $a (@{$r->{"allocSites"}}) {
+                $site{$a->[0]} += $a->[2];
+            }
+        }
+
+        next   if ($calls == 0);
+
+        $allocText .= sprintf("--  %-30s %14d %12.3f %12.3f\n", $s, $calls, $bytes / 1024 / 1024 / 1024, $peak / 1024 / 1024 / 1024);
+
+        my $n = 0;
+
+        foreach my $a (sort { $site{$b} <=> $site{$a} } keys %site) {
+            last   if (++$n > 5);
+
+            $allocText .= sprintf("--      %10.3f GB  %s\n", $site{$a} / 1024 / 1024 / 1024, $a);
+        }
+    }
+
+    if (defined($allocText)) {
+        $text .= "--\n";
+        $text .= "-- Allocations (through new; peak is the largest of any one job), with the call sites sampled most:\n";
+        $text .= "--\n";
+        $text .= "--  stage                               allocs allocated-GB      peak-GB\n";
+        $text .= "--  ------------------------------ -------------- ------------ ------------\n";
+        $text .= $allocText;
+    }
+
+    $report{"performance"} = $text;
+}
+
+
+
 sub generateReport ($) {
     my $asm = shift @_;
 
     loadReport($asm);
+    summarizePerformance();
     saveReport($asm);
 }
 
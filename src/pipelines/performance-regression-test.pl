@@ -0,0 +1,390 @@
+#!/usr/bin/env perl
+
+###############################################################################
+ #
+ #  This file is part of canu, a software program that assembles whole-genome
+ #  sequencing reads into contigs.
+ #
+ #  This software is based on:
+ #    'Celera Assembler' (http://wgs-assembler.sourceforge.net)
+ #    the 'kmer package' (http://kmer.sourceforge.net)
+ #  both originally distributed by Applera Corporation under the GNU General
+ #  Public License, version 2.
+ #
+ #  Canu branched from Celera Assembler at its revision 4587.
+ #  Canu branched from the kmer project at its revision 1994.
+ #
+ #  File 'README.licenses' in the root directory of this distribution contains
+ #  full conditions and disclaimers for each license.
+ ##
+
+use strict;
+
+use Cwd qw(getcwd abs_path);
+use Time::HiRes qw(time);
+
+#  Build a fixed synthetic genome and read set at several sizes, assemble
+#  each with canu, and report per-stage time and memory (from the canu-perf/
+#  files the binaries write) along with assembly accuracy (from bogus and
+#  bogusness, if nucmer is around).
+#
+#  Everything is seeded, so two canu builds run in the same output directory
+#  get the same inputs; the summary files are meant to be diffed between
+#  releases.
+#
+#  Each scale is a directory in the output directory:
+#    genome.fasta       - the reference; 'repeats' copies of a 'repeatSize'
+#                         repeat interleaved with unique sequence
+#    reads.fastq        - simulated reads
+#    asm/               - the canu assembly
+#    eval/              - nucmer, bogus and bogusness results
+#    summary.txt        - what is printed at the end
+#
+#  and summary.tsv in the output directory has one line per stage per scale.
+
+my $bin        = undef;
+my $outDir     = "performance-regression";
+my @scales     = ( 500000, 2000000, 8000000 );
+my $seed       = 1;
+my $repeats    = 5;
+my $repeatSize = 7000;
+my $readLen    = 10000;
+my $coverage   = 30;
+my $errorRate  = 0.01;
+my $canuOpts   = "";
+my $evaluate   = 1;
+my $err        = 0;
+
+while (scalar(@ARGV) > 0) {
+    my $arg = shift @ARGV;
+
+    if    ($arg eq "-bin")         { $bin        = shift @ARGV; }
+    elsif ($arg eq "-o")           { $outDir     = shift @ARGV; }
+    elsif ($arg eq "-scales")      { @scales     = split ',', shift @ARGV; }
+    elsif ($arg eq "-seed")        { $seed       = shift @ARGV; }
+    elsif ($arg eq "-repeats")     { $repeats    = shift @ARGV; }
+    elsif ($arg eq "-repeatsize")  { $repeatSize = shift @ARGV; }
+    elsif ($arg eq "-readlength")  { $readLen    = shift @ARGV; }
+    elsif ($arg eq "-coverage")    { $coverage   = shift @ARGV; }
+    elsif ($arg eq "-error")       { $errorRate  = shift @ARGV; }
+    elsif ($arg eq "-canu")        { $canuOpts   = shift @ARGV; }
+    elsif ($arg eq "-noeval")      { $evaluate   = 0; }
+    else {
+        print STDERR "ERROR: unknown option '$arg'\n";
+        $err++;
+    }
+}
+
+foreach my $s (@scales) {
+    $s = $1 * 1000           if ($s =~ m/^(\d+)k$/i);
+    $s = $1 * 1000000        if ($s =~ m/^(\d+)m$/i);
+
+    if (($s !~ m/^\d+$/) || ($s < 2 * $readLen)) {
+        print STDERR "ERROR: scale '$s' isn't a genome size at least twice the read length.\n";
+        $err++;
+    }
+}
+
+if ($err) {
+    print STDERR "usage: $0 [options]\n";
+    print STDERR "\n";
+    print STDERR "  -bin DIR         canu binary directory (default: the one this script is in)\n";
+    print STDERR "  -o DIR           output directory (default: $outDir)\n";
+    print STDERR "  -scales S,...    genome sizes to test; k and m suffixes allowed (default: 500k,2m,8m)\n";
+    print STDERR "  -seed N          random seed for the genome and reads (default: $seed)\n";
+    print STDERR "  -repeats N       number of copies of the repeat (default: $repeats)\n";
+    print STDERR "  -repeatsize L    length of the repeat (default: $repeatSize)\n";
+    print STDERR "  -readlength L    mean read length (default: $readLen)\n";
+    print STDERR "  -coverage C      read coverage (default: $coverage)\n";
+    print STDERR "  -error E         read error rate, split evenly over mismatch/insert/delete (default: $errorRate)\n";
+    print STDERR "  -canu 'OPTS'     extra options for canu\n";
+    print STDERR "  -noeval          don't compute accuracy, even if nucmer is available\n";
+    print STDERR "\n";
+    print STDERR "An existing scale directory is reused: inputs aren't regenerated and\n";
+    print STDERR "canu resumes.  Remove it (or use a new -o) to measure from scratch.\n";
+    exit(1);
+}
+
+if (!defined($bin)) {
+    $bin = abs_path($0);
+    $bin =~ s!/[^/]*$!!;
+}
+
+$bin    = abs_path($bin);
+$outDir = abs_path($outDir)   if (-d $outDir);
+
+foreach my $p ("canu", "sequence", "fastqSimulate", "bogus", "bogusness") {
+    die "ERROR: '$bin/$p' not found; use -bin.\n"   if (! -x "$bin/$p");
+}
+
+if (($evaluate) && (system("nucmer --version > /dev/null 2>&1") != 0)) {
+    print STDERR "-- nucmer not found; accuracy will not be computed.\n";
+    $evaluate = 0;
+}
+
+sub runCommand ($$) {
+    my $dir = shift @_;
+    my $cmd = shift @_;
+    my $cwd = getcwd();
+
+    print STDERR "-- $cmd\n";
+
+    chdir($dir);
+    my $rc = system($cmd);
+    chdir($cwd);
+
+    die "ERROR: command failed with exit code ", $rc >> 8, ".\n"   if ($rc != 0);
+}
+
+sub readSequence ($) {
+    my $file = shift @_;
+    my $seq  = "";
+
+    open(F, "< $file") or die "ERROR: failed to open '$file': $!\n";
+    while (<F>) {
+        chomp;
+        $seq .= $_   if ($_ !~ m/^>/);
+    }
+    close(F);
+
+    return($seq);
+}
+
+#  The genome is unique sequence split into repeats+1 pieces with a copy of
+#  the repeat between each.  Both pieces come from 'sequence generate' with
+#  fixed seeds.
+
+sub makeGenome ($$) {
+    my $dir  = shift @_;
+    my $size = shift @_;
+
+    return   if (-e "$dir/genome.fasta");
+
+    my $uLen = $size - $repeats * $repeatSize;
+
+    die "ERROR: genome size $size too small for $repeats repeats of length $repeatSize.\n"   if ($uLen < $repeatSize);
+
+    runCommand($dir, "$bin/sequence generate -min $repeatSize -max $repeatSize -sequences 1 -seed " . ($seed + 1) . " > repeat.fasta");
+    runCommand($dir, "$bin/sequence generate -min $uLen -max $uLen -sequences 1 -seed $seed > unique.fasta");
+
+    my $R   = readSequence("$dir/repeat.fasta");
+    my $U   = readSequence("$dir/unique.fasta");
+    my $G   = "";
+    my $pLen = int($uLen / ($repeats + 1));
+
+    for (my $r=0; $r < $repeats; $r++) {
+        $G .= substr($U, $r * $pLen, $pLen);
+        $G .= $R;
+    }
+    $G .= substr($U, $repeats * $pLen);
+
+    open(O, "> $dir/genome.fasta.WORKING") or die "ERROR: failed to open '$dir/genome.fasta.WORKING': $!\n";
+    print O ">genome\n";
+    for (my $p=0; $p < length($G); $p += 100) {
+        print O substr($G, $p, 100), "\n";
+    }
+    close(O);
+
+    rename("$dir/genome.fasta.WORKING", "$dir/genome.fasta");
+    unlink("$dir/repeat.fasta");
+    unlink("$dir/unique.fasta");
+}
+
+sub makeReads ($) {
+    my $dir = shift @_;
+    my $e   = $errorRate / 3;
+
+    return   if (-e "$dir/reads.fastq");
+
+    runCommand($dir, "$bin/fastqSimulate -f genome.fasta -o reads -l $readLen -x $coverage -em $e -ei $e -ed $e -seed $seed -se > reads.err 2>&1");
+
+    rename("$dir/reads.s.fastq", "$dir/reads.fastq");
+}
+
+#  Runs are grouped into stages by the directory they ran in, the same way
+#  the canu report does.
+
+sub loadStages ($) {
+    my $asm  = shift @_;
+    my $base = abs_path($asm);
+    my %stages;
+
+    open(L, "ls $asm/canu-perf/*.json 2> /dev/null |");
+    while (<L>) {
+        chomp;
+
+        next   if (m/\.trace\.json$/);
+
+        my %r;
+
+        open(J, "< $_") or next;
+        while (<J>) {
+            $r{$1} = $2   if (m/^\s*"(program|directory)":\s*"(.*)",$/);
+            $r{$1} = $2   if (m/^\s*"(wallSeconds|cpuSeconds|maxMemoryBytes)":\s*([0-9.]+),$/);
+        }
+        close(J);
+
+        next   if (!defined($r{"program"}));
+
+        my $d = $r{"directory"};
+
+        if    (!defined($d))          { $d = "(unknown)"; }
+        elsif ($d eq $base)           { $d = "."; }
+        elsif ($d =~ m!^\Q$base\E/!)  { $d = substr($d, length($base) + 1); }
+        else                          { $d = "(elsewhere)"; }
+
+        $stages{$d}{"runs"}++;
+        $stages{$d}{"wall"} += $r{"wallSeconds"};
+        $stages{$d}{"cpu"}  += $r{"cpuSeconds"};
+        $stages{$d}{"mem"}   = $r{"maxMemoryBytes"}   if ($stages{$d}{"mem"} < $r{"maxMemoryBytes"});
+    }
+    close(L);
+
+    return(%stages);
+}
+
+#  Map reads and contigs to the reference, build the ideal unitigs from the
+#  reads, and score the contigs against them.
+
+sub evaluateAssembly ($) {
+    my $dir = shift @_;
+    my %acc;
+
+    my $contigs = "$dir/asm/asm.contigs.fasta";
+
+    return(%acc)   if ((! -e $contigs) || (-z $contigs));
+
+    system("mkdir -p $dir/eval");
+
+    runCommand("$dir/eval", "nucmer --maxmatch --coords -p reads ../genome.fasta ../reads.fastq > reads.nucmer.err 2>&1")       if (! -e "$dir/eval/reads.coords");
+    runCommand("$dir/eval", "$bin/bogus -nucmer reads.coords -reference ../genome.fasta -output ideal > ideal.err 2>&1")          if (! -e "$dir/eval/ideal.intervals");
+    runCommand("$dir/eval", "nucmer --maxmatch --coords -p contigs ../genome.fasta ../asm/asm.contigs.fasta > contigs.nucmer.err 2>&1");
+    runCommand("$dir/eval", "$bin/bogusness -reference ../genome.fasta -ideal ideal.intervals -nucmer contigs.coords -output contigs > bogusness.err 2>&1");
+
+    #  ideal.intervals has one ideal unitig per line.
+
+    my %ideal;
+
+    open(F, "< $dir/eval/ideal.intervals") or die "ERROR: failed to open '$dir/eval/ideal.intervals': $!\n";
+    while (<F>) {
+        my @v = split '\s+', $_;
+        $ideal{$v[3]}++;
+        $acc{"idealTotal"}++;
+    }
+    close(F);
+
+    $acc{"idealUniq"} = $ideal{"UNIQ"} + 0;
+    $acc{"idealRept"} = $ideal{"REPT"} + 0;
+
+    #  Each line of the bogusness output is one piece of a contig aligned to
+    #  the reference, and an ideal unitig it intersects:
+    #    | utg || n of m || bgn-end || ref || bgn-end || STATUS || TYPE || idl || ...
+    #  A contig aligned in more than one piece is a misassembly; an ideal
+    #  unitig a contig piece CONTAINS is fully assembled.
+
+    my %contigs;
+    my %split;
+    my %assembled;
+
+    open(F, "< $dir/eval/contigs.bogusness") or die "ERROR: failed to open '$dir/eval/contigs.bogusness': $!\n";
+    while (<F>) {
+        s/\|\|/|/g;
+        my @v = map { s/^\s+//; s/\s+$//; $_ } split '\|', $_;
+
+        next   if (scalar(@v) < 9);
+
+        my ($utg, $piece, $status, $type, $idl) = ($v[1], $v[2], $v[6], $v[7], $v[8]);
+
+        $contigs{$utg}++;
+        $split{$utg}++                    if ($piece =~ m/^\d+\s+of\s+(\d+)$/) && ($1 > 1);
+        $assembled{"$type$idl"}++          if ($status eq "CONTAINS");
+    }
+    close(F);
+
+    $acc{"contigsAligned"} = scalar(keys %contigs);
+    $acc{"contigsSplit"}   = scalar(keys %split);
+    $acc{"idealAssembled"} = scalar(keys %assembled);
+
+    return(%acc);
+}
+
+#  Main.
+
+system("mkdir -p $outDir");
+$outDir = abs_path($outDir);
+
+my $summary = "";
+my $tsv     = "scale\tstage\truns\twallSeconds\tcpuSeconds\tmaxMemoryBytes\n";
+
+foreach my $size (@scales) {
+    my $dir = "$outDir/$size";
+
+    system("mkdir -p $dir");
+
+    makeGenome($dir, $size);
+    makeReads($dir);
+
+    my $bgn = time();
+    runCommand($dir, "$bin/canu -p asm -d asm genomeSize=$size useGrid=false $canuOpts -pacbio-raw reads.fastq > canu.out 2>&1");
+    my $end = time();
+
+    my %stages = loadStages("$dir/asm");
+    my %acc    = ($evaluate) ? evaluateAssembly($dir) : ();
+
+    my $text;
+    my ($tWall, $tCpu, $tMem) = (0, 0, 0);
+
+    $text .= "--\n";
+    $text .= sprintf("-- Genome size %d: %d reads of mean length %d at %dx, %.3f error.\n", $size, int($size * $coverage / $readLen), $readLen, $coverage, $errorRate);
+    $text .= sprintf("-- canu finished in %.1f seconds.\n", $end - $bgn);
+    $text .= "--\n";
+    $text .= "--  stage                                 runs      wall-sec       cpu-sec   max-mem-MB\n";
+    $text .= "--  ----------------------------------- ------ ------------- ------------- ------------\n";
+
+    foreach my $s (sort { $stages{$b}{"wall"} <=> $stages{$a}{"wall"} } keys %stages) {
+        my $st = $stages{$s};
+
+        $text .= sprintf("--  %-35s %6d %13.1f %13.1f %12.1f\n", $s, $st->{"runs"}, $st->{"wall"}, $st->{"cpu"}, $st->{"mem"} / 1024 / 1024);
+        $tsv  .= "$size\t$s\t$st->{'runs'}\t$st->{'wall'}\t$st->{'cpu'}\t$st->{'mem'}\n";
+
+        $tWall += $st->{"wall"};
+        $tCpu  += $st->{"cpu"};
+        $tMem   = $st->{"mem"}   if ($tMem < $st->{"mem"});
+    }
+
+    $text .= sprintf("--  %-35s %6s %13.1f %13.1f %12.1f\n", "(total)", "", $tWall, $tCpu, $tMem / 1024 / 1024);
+    $tsv  .= "$size\t(total)\t\t$tWall\t$tCpu\t$tMem\n";
+
+    $text .= "--\n";
+
+    if    (!$evaluate) {
+        $text .= "-- Accuracy not computed.\n";
+    }
+    elsif (!defined($acc{"idealTotal"})) {
+        $text .= "-- Accuracy not computed; no contigs.\n";
+    }
+    else {
+        $text .= sprintf("-- Ideal unitigs:      %d (%d unique, %d repeat)\n", $acc{"idealTotal"}, $acc{"idealUniq"}, $acc{"idealRept"});
+        $text .= sprintf("-- Fully assembled:    %d (%.1f%%)\n", $acc{"idealAssembled"}, 100.0 * $acc{"idealAssembled"} / $acc{"idealTotal"});
+        $text .= sprintf("-- Contigs aligned:    %d\n", $acc{"contigsAligned"});
+        $text .= sprintf("-- Contigs misjoined:  %d (aligned in more than one piece)\n", $acc{"contigsSplit"});
+
+        $tsv  .= "$size\t(accuracy)\t$acc{'idealTotal'}\t$acc{'idealAssembled'}\t$acc{'contigsAligned'}\t$acc{'contigsSplit'}\n";
+    }
+
+    open(O, "> $dir/summary.txt");
+    print O $text;
+    close(O);
+
+    $summary .= $text;
+}
+
+open(O, "> $outDir/summary.tsv");
+print O $tsv;
+close(O);
+
+print $summary;
+print "--\n";
+print "-- Per-stage results in '$outDir/summary.tsv'.\n";
+
+exit(0);
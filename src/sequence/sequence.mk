@@ -11,6 +11,7 @@ endif
 TARGET   := sequence
 SOURCES  := sequence.C \
             sequence-extract.C \
+            sequence-faidx.C \
             sequence-generate.C \
             sequence-mutate.C \
             sequence-sample.C \
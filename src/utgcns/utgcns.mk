@@ -10,7 +10,7 @@ endif
 TARGET   := utgcns
 SOURCES  := utgcns.C stashContains.C unitigConsensus.C
 
-SRC_INCDIRS  := .. ../utility ../stores ../overlapInCore/libedlib libpbutgcns libboost
+SRC_INCDIRS  := .. ../utility ../stores ../overlapInCore/libedlib libpbutgcns
 
 TGT_LDFLAGS := -L${TARGET_DIR}/lib
 TGT_LDLIBS  := -lcanu